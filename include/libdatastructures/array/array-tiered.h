@@ -0,0 +1,174 @@
+/**
+ * \file   array-tiered.h
+ * \brief  Tiered (chunked) array - struct. and type definitions and function declarations
+ */
+#ifndef LIBDATASTRUCTURES_ARRAY_TIERED_H
+#define LIBDATASTRUCTURES_ARRAY_TIERED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include "libdatastructures/array/array.h"
+
+/* ************************************************************************************************/
+
+/** Chunk of a tiered array, a fixed-length ring of elements (defined in 'array-tiered.c') */
+struct array_tiered_chunk;
+
+/**
+ * Tiered array structure, which stores the elements in a directory of fixed-length ring chunks.
+ * Every chunk but the last one is full, so an element is still found in constant time, while
+ * pushing or popping an element in the middle of the array only shifts the elements of one chunk
+ * and rotates the others by one element. The length of the chunks is kept about the square root
+ * of the no. of elements, so both take O(sqrt(n)) time.
+ */
+struct array_tiered {
+    /** Base 2 logarithm of the length of every chunk */
+    size_t chunk_shift;
+    /** Pointer to the allocated directory of chunks */
+    struct array_tiered_chunk **chunks;
+    /** No. of chunks in use */
+    size_t nchunks;
+    /** Total length of the directory of chunks */
+    size_t dir_length;
+    /** No. of elements stored on the array */
+    size_t count;
+};
+
+/** Tiered array type */
+typedef struct array_tiered array_tiered_s;
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Initialize a tiered array, which grows as needed.
+ * \param  a  pointer to the array to be initialized
+ */
+void array_init_tiered(array_tiered_s *a);
+
+/**
+ * \brief   Create and initialize a new tiered array.
+ * \return  a pointer to the allocated array
+ */
+array_tiered_s *array_new_tiered(void);
+
+/**
+ * \brief   Push an element onto the back (end) of the tiered array.
+ * \param   a     the array whose element is to be pushed onto
+ * \param   elem  the element to be pushed
+ * \return  the return code for the push operation
+ */
+array_rc_e array_tiered_push_back(array_tiered_s *a, void *elem);
+
+/**
+ * \brief   Push an element onto the front (beginning) of the tiered array.
+ * \param   a     the array whose element is to be pushed onto
+ * \param   elem  the element to be pushed
+ * \return  the return code for the push operation
+ */
+array_rc_e array_tiered_push_front(array_tiered_s *a, void *elem);
+
+/**
+ * \brief   Push an element onto an arbitrary position of the tiered array.
+ * \param   a     the array whose element is to be pushed onto
+ * \param   elem  the element to be pushed
+ * \param   pos   the position where the element is to be pushed
+ * \return  the return code for the push operation
+ */
+array_rc_e array_tiered_push_at(array_tiered_s *a, void *elem, size_t pos);
+
+/**
+ * \brief   Get the number of elements stored in the tiered array.
+ * \param   a  the array whose number of elements is to be gotten
+ * \return  the number of elements stored in the array
+ */
+size_t array_tiered_count(array_tiered_s *a);
+
+/**
+ * \brief   Get ('pick') the element from the back (end) of the tiered array.
+ * \param   a  the array whose element is to be picked from its back
+ * \return  the element picked from the back of the array
+ */
+void *array_tiered_pick_back(array_tiered_s *a);
+
+/**
+ * \brief   Get ('pick') the element from the front (beginning) of the tiered array.
+ * \param   a  the array whose element is to be picked from its front
+ * \return  the element picked from the front of the array
+ */
+void *array_tiered_pick_front(array_tiered_s *a);
+
+/**
+ * \brief   Get ('pick') the element from an arbitrary position of the tiered array.
+ * \param   a    the array whose element is to be picked from the given position
+ * \param   pos  the position where the element is to be picked
+ * \return  the element picked from the given position of the array
+ */
+void *array_tiered_pick_at(array_tiered_s *a, size_t pos);
+
+/**
+ * \brief   Remove ('pop') an element from the back (end) of the tiered array.
+ * \param   a  the array whose element is to be popped from its back
+ * \return  the element popped from the back of the array
+ */
+void *array_tiered_pop_back(array_tiered_s *a);
+
+/**
+ * \brief   Remove ('pop') an element from the front (beginning) of the tiered array.
+ * \param   a  the array whose element is to be popped from its front
+ * \return  the element popped from the front of the array
+ */
+void *array_tiered_pop_front(array_tiered_s *a);
+
+/**
+ * \brief   Remove ('pop') an element from an arbitrary position of the tiered array.
+ * \param   a    the array whose element is to be popped from the given position
+ * \param   pos  the position where the element is to be popped
+ * \return  the element popped from the given position of the array
+ */
+void *array_tiered_pop_at(array_tiered_s *a, size_t pos);
+
+/**
+ * \brief   Replace the element on a given position of the tiered array by another element.
+ * \param   a     the array whose element is to be replaced
+ * \param   elem  the new element that will replace the element on a given position
+ * \param   pos   the position the old element is found
+ * \return  the old element which was replaced by the new one
+ */
+void *array_tiered_replace(array_tiered_s *a, void *elem, size_t pos);
+
+/**
+ * \brief   Traverse all the tiered array elements from front to back, applying the 'elem_visit'
+ *          callback function to all its elements.
+ * \param   a           the array to be traversed by
+ * \param   elem_visit  pointer to a callback function which 'visits' all elems. in the array
+ * \return  the return code for the traversal operation
+ */
+array_rc_e array_tiered_traverse(array_tiered_s *a, void (*elem_visit)(void *));
+
+/**
+ * \brief   Remove all the elements from the tiered array, deallocating them (if an 'elem_destroy'
+ *          callback function is provided) and its chunks, making the array empty.
+ * \param   a             the array whose elements are to be 'destroyed'
+ * \param   elem_destroy  a pointer to a callback func. which deallocates all the array elements
+ * \return  the return code for the 'clear' operation
+ */
+array_rc_e array_tiered_clear(array_tiered_s *a, void (*elem_destroy)(void **));
+
+/**
+ * \brief   Deallocate ('destroy') all the elements in the tiered array and the array itself.
+ * \param   a             pointer to the array to be 'destroyed'
+ * \param   elem_destroy  a pointer to a callback func. which deallocates all the array elements
+ * \return  the return code for the 'destroy' operation
+ */
+array_rc_e array_tiered_destroy(array_tiered_s **a, void (*elem_destroy)(void **));
+
+/* ************************************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LIBDATASTRUCTURES_ARRAY_TIERED_H */
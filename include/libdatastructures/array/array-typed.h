@@ -0,0 +1,179 @@
+/**
+ * \file   array-typed.h
+ * \brief  Typed (value) array - struct. and type definitions and function declarations
+ */
+#ifndef LIBDATASTRUCTURES_ARRAY_TYPED_H
+#define LIBDATASTRUCTURES_ARRAY_TYPED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include "libdatastructures/array/array.h"
+
+/* ************************************************************************************************/
+
+/**
+ * Typed array structure, which stores copies of fixed-size elements (ints, doubles, small structs)
+ * inline and contiguously, instead of pointers to separately allocated elements
+ */
+struct array_typed {
+    /** Size (in bytes) of every element stored on the array */
+    size_t elem_size;
+    /** Total length of the array (the no. of elements it can store before growing) */
+    size_t length;
+    /** Pointer to the allocated buffer where the elements are stored contiguously */
+    void *elems;
+    /** No. of elements stored on the array */
+    size_t count;
+};
+
+/** Typed array type */
+typedef struct array_typed array_typed_s;
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Initialize a typed array, whose length is doubled every time it gets full.
+ * \param  a          pointer to the array to be initialized
+ * \param  elem_size  the size (in bytes) of every element to be stored; it must not be zero
+ * \param  capacity   the initial length of the array (it may be zero)
+ */
+void array_init_typed(array_typed_s *a, size_t elem_size, size_t capacity);
+
+/**
+ * \brief   Create and initialize a new typed array.
+ * \param   elem_size  the size (in bytes) of every element to be stored; it must not be zero
+ * \param   capacity   the initial length of the array (it may be zero)
+ * \return  a pointer to the allocated array, or null if the element size is zero
+ */
+array_typed_s *array_new_typed(size_t elem_size, size_t capacity);
+
+/**
+ * \brief   Make sure the typed array is able to store at least a given number of elements,
+ *          reallocating its storage at once if needed.
+ * \param   a         the array whose storage is to be reserved
+ * \param   capacity  the minimum number of elements the array must be able to store
+ * \return  the return code for the reserve operation
+ */
+array_rc_e array_typed_reserve(array_typed_s *a, size_t capacity);
+
+/**
+ * \brief   Push a copy of an element onto the back (end) of the typed array.
+ * \param   a     the array whose element is to be pushed onto
+ * \param   elem  pointer to the element to be copied onto the array
+ * \return  the return code for the push operation
+ */
+array_rc_e array_typed_push_back(array_typed_s *a, const void *elem);
+
+/**
+ * \brief   Push a copy of an element onto the front (beginning) of the typed array.
+ * \param   a     the array whose element is to be pushed onto
+ * \param   elem  pointer to the element to be copied onto the array
+ * \return  the return code for the push operation
+ */
+array_rc_e array_typed_push_front(array_typed_s *a, const void *elem);
+
+/**
+ * \brief   Push a copy of an element onto an arbitrary position of the typed array.
+ * \param   a     the array whose element is to be pushed onto
+ * \param   elem  pointer to the element to be copied onto the array (which may be one of the
+ *                array's own elements, even if the array is reallocated)
+ * \param   pos   the position where the element is to be pushed
+ * \return  the return code for the push operation
+ */
+array_rc_e array_typed_push_at(array_typed_s *a, const void *elem, size_t pos);
+
+/**
+ * \brief   Get the number of elements stored in the typed array.
+ * \param   a  the array whose number of elements is to be gotten
+ * \return  the number of elements stored in the array
+ */
+size_t array_typed_count(array_typed_s *a);
+
+/**
+ * \brief   Get the contiguous storage of the typed array, so its elements can be scanned directly.
+ * \param   a  the array whose storage is to be gotten
+ * \return  pointer to the first element, valid until the array is modified
+ */
+void *array_typed_data(array_typed_s *a);
+
+/**
+ * \brief   Get ('pick') the element from the back (end) of the typed array.
+ * \param   a  the array whose element is to be picked from its back
+ * \return  pointer to the element stored in the array, valid until the array is modified
+ */
+void *array_typed_pick_back(array_typed_s *a);
+
+/**
+ * \brief   Get ('pick') the element from the front (beginning) of the typed array.
+ * \param   a  the array whose element is to be picked from its front
+ * \return  pointer to the element stored in the array, valid until the array is modified
+ */
+void *array_typed_pick_front(array_typed_s *a);
+
+/**
+ * \brief   Get ('pick') the element from an arbitrary position of the typed array.
+ * \param   a    the array whose element is to be picked from the given position
+ * \param   pos  the position where the element is to be picked
+ * \return  pointer to the element stored in the array, valid until the array is modified
+ */
+void *array_typed_pick_at(array_typed_s *a, size_t pos);
+
+/**
+ * \brief   Remove ('pop') an element from the back (end) of the typed array.
+ * \param   a     the array whose element is to be popped from its back
+ * \param   elem  pointer to where the popped element is to be copied to (it may be null)
+ * \return  the return code for the pop operation
+ */
+array_rc_e array_typed_pop_back(array_typed_s *a, void *elem);
+
+/**
+ * \brief   Remove ('pop') an element from the front (beginning) of the typed array.
+ * \param   a     the array whose element is to be popped from its front
+ * \param   elem  pointer to where the popped element is to be copied to (it may be null)
+ * \return  the return code for the pop operation
+ */
+array_rc_e array_typed_pop_front(array_typed_s *a, void *elem);
+
+/**
+ * \brief   Remove ('pop') an element from an arbitrary position of the typed array.
+ * \param   a     the array whose element is to be popped from the given position
+ * \param   pos   the position where the element is to be popped
+ * \param   elem  pointer to where the popped element is to be copied to (it may be null)
+ * \return  the return code for the pop operation
+ */
+array_rc_e array_typed_pop_at(array_typed_s *a, size_t pos, void *elem);
+
+/**
+ * \brief   Traverse all the typed array elements from front to back, applying the 'elem_visit'
+ *          callback function to all its elements.
+ * \param   a           the array to be traversed by
+ * \param   elem_visit  pointer to a callback function which 'visits' all elems. in the array, being
+ *                      given a pointer to each element stored in the array
+ * \return  the return code for the traversal operation
+ */
+array_rc_e array_typed_traverse(array_typed_s *a, void (*elem_visit)(void *));
+
+/**
+ * \brief   Remove all the elements from the typed array, making it empty.
+ * \param   a  the array whose elements are to be removed
+ * \return  the return code for the 'clear' operation
+ */
+array_rc_e array_typed_clear(array_typed_s *a);
+
+/**
+ * \brief   Deallocate ('destroy') the typed array storage and the array itself.
+ * \param   a  pointer to the array to be 'destroyed'
+ * \return  the return code for the 'destroy' operation
+ */
+array_rc_e array_typed_destroy(array_typed_s **a);
+
+/* ************************************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LIBDATASTRUCTURES_ARRAY_TYPED_H */
@@ -9,24 +9,38 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stddef.h>
-#include "libdatastructures/array/array-node.h"
+#include <stdint.h>
 
 /* ************************************************************************************************/
 
 /** Array structure */
 struct array {
-    /** Total length of the array (max. elements) */
-    const size_t length;
-    /** Pointer to the allocated pointer array */
-    array_node_s **elems;
+    /** Total length of the array (max. elements, or the current capacity if it's growable) */
+    size_t length;
+    /** Pointer to the allocated buffer of elements, stored contiguously as a ring */
+    void **elems;
+    /** Slot of the buffer where the first element (the 'front' of the array) is stored */
+    size_t front;
     /** No. of elements stored on the array */
     size_t count;
+    /** Boolean indicating whether the array should grow instead of being full */
+    bool growable;
 };
 
 /** Array type */
 typedef struct array array_s;
 
+/** Position returned by the array search operations when no element is found */
+#define ARRAY_POS_NONE SIZE_MAX
+
+#ifndef ARRAY_PARALLEL_MIN_GRAIN
+/** Minimum no. of elements handled by each thread of the parallel array operations (it may be
+    overridden when building the library) */
+#define ARRAY_PARALLEL_MIN_GRAIN 4096
+#endif
+
 /** Array operations return codes */
 enum array_rc {
     /** No error */
@@ -43,7 +57,7 @@ enum array_rc {
     ARRAY_RC_ELEM_NULL = -5,
     /** The callback function to operate on the element is null */
     ARRAY_RC_ELEM_CB_NULL = -6,
-    /** The allocation of a new node has failed */
+    /** The allocation of the array storage has failed */
     ARRAY_RC_NODE_ALLOC_ERR = -7
 };
 
@@ -66,6 +80,44 @@ void array_init(array_s *a, size_t length);
  */
 array_s *array_new(size_t length);
 
+/**
+ * \brief  Initialize a growable array, whose length is doubled every time it gets full.
+ * \param  a         pointer to the array to be initialized
+ * \param  capacity  the initial length of the array (it may be zero)
+ */
+void array_init_growable(array_s *a, size_t capacity);
+
+/**
+ * \brief   Create and initialize a new growable array.
+ * \param   capacity  the initial length of the array (it may be zero)
+ * \return  a pointer to the allocated array
+ */
+array_s *array_new_growable(size_t capacity);
+
+/**
+ * \brief   Make sure the array is able to store at least a given number of elements, reallocating
+ *          its storage at once if needed. It never makes the array shorter.
+ * \param   a         the array whose storage is to be reserved
+ * \param   capacity  the minimum number of elements the array must be able to store
+ * \return  the return code for the reserve operation
+ */
+array_rc_e array_reserve(array_s *a, size_t capacity);
+
+/**
+ * \brief   Reallocate the array storage so its length is exactly the number of stored elements.
+ *          Note that a non-growable array gets full after this operation.
+ * \param   a  the array whose storage is to be shrunk
+ * \return  the return code for the shrink operation
+ */
+array_rc_e array_shrink_to_fit(array_s *a);
+
+/**
+ * \brief   Get the number of elements the array is able to store without reallocating its storage.
+ * \param   a  the array whose capacity is to be gotten
+ * \return  the current length of the array
+ */
+size_t array_capacity(array_s *a);
+
 /**
  * \brief   Push an element onto the back (end) of the array
  * \param   a     the array whose element is to be pushed onto
@@ -91,6 +143,27 @@ array_rc_e array_push_front(array_s *a, void *elem);
  */
 array_rc_e array_push_at(array_s *a, void *elem, int pos);
 
+/**
+ * \brief   Push an element onto an arbitrary position of the array, given as a 'size_t' index
+ *          (so it's able to address more than INT_MAX elements).
+ * \param   a     the array whose element is to be pushed onto
+ * \param   elem  the element to be pushed
+ * \param   pos   the position where the element is to be pushed
+ * \return  the return code for the push operation
+ */
+array_rc_e array_push_at_idx(array_s *a, void *elem, size_t pos);
+
+/**
+ * \brief   Insert a range of elements onto an arbitrary position of the array at once, shifting
+ *          the elements already stored as whole blocks.
+ * \param   a      the array whose elements are to be inserted onto
+ * \param   pos    the position where the first element is to be inserted
+ * \param   elems  the elements to be inserted, which must not be stored in the array itself
+ * \param   n      the number of elements to be inserted
+ * \return  the return code for the insert operation
+ */
+array_rc_e array_insert_range(array_s *a, size_t pos, void **elems, size_t n);
+
 /**
  * \brief   Get the number of elements stored in the array.
  * \param   a  the array whose number of elements is to be gotten
@@ -120,6 +193,15 @@ void *array_pick_front(array_s *a);
  */
 void *array_pick_at(array_s *a, int pos);
 
+/**
+ * \brief   Get ('pick') the element from an arbitrary position of the array, given as a 'size_t'
+ *          index.
+ * \param   a    the array whose element is to be picked from the given position
+ * \param   pos  the position where the element is to be picked
+ * \return  the element picked from the given position of the array
+ */
+void *array_pick_at_idx(array_s *a, size_t pos);
+
 /**
  * \brief   Remove ('pop') an element from the back (end) of the array.
  * \param   a  the array whose element is to be popped from its back
@@ -141,6 +223,27 @@ void *array_pop_front(array_s *a);
  */
 void *array_pop_at(array_s *a, int pos);
 
+/**
+ * \brief   Remove ('pop') an element from an arbitrary position of the array, given as a 'size_t'
+ *          index.
+ * \param   a    the array whose element is to be popped from the given position
+ * \param   pos  the position where the element is to be popped
+ * \return  the element popped from the given position of the array
+ */
+void *array_pop_at_idx(array_s *a, size_t pos);
+
+/**
+ * \brief   Remove a range of elements from an arbitrary position of the array at once, shifting
+ *          the remaining elements as whole blocks, and deallocating the removed elements (if an
+ *          'elem_destroy' callback function is provided).
+ * \param   a             the array whose elements are to be removed
+ * \param   pos           the position of the first element to be removed
+ * \param   n             the number of elements to be removed
+ * \param   elem_destroy  a pointer to a callback func. which deallocates the removed elements
+ * \return  the return code for the remove operation
+ */
+array_rc_e array_erase_range(array_s *a, size_t pos, size_t n, void (*elem_destroy)(void **));
+
 /**
  * \brief   Replace the element on a given position of the array by another element.
  * \param   a     the array whose element is to be replaced
@@ -150,6 +253,16 @@ void *array_pop_at(array_s *a, int pos);
  */
 void *array_replace(array_s *a, void *elem, int pos);
 
+/**
+ * \brief   Replace the element on a given position of the array, given as a 'size_t' index, by
+ *          another element.
+ * \param   a     the array whose element is to be replaced
+ * \param   elem  the new element that will replace the element on a given position
+ * \param   pos   the position the old element is found
+ * \return  the old element which was replaced by the new one
+ */
+void *array_replace_idx(array_s *a, void *elem, size_t pos);
+
 /**
  * \brief   Swap two elements from two given positions of the array.
  * \param   a     the array whose two elements will be swapped
@@ -159,6 +272,15 @@ void *array_replace(array_s *a, void *elem, int pos);
  */
 array_rc_e array_swap(array_s *a, int pos1, int pos2);
 
+/**
+ * \brief   Swap two elements from two given positions of the array, given as 'size_t' indexes.
+ * \param   a     the array whose two elements will be swapped
+ * \param   pos1  the position of the first element
+ * \param   pos2  the position of the second element
+ * \return  the return code for the swap operation
+ */
+array_rc_e array_swap_idx(array_s *a, size_t pos1, size_t pos2);
+
 /**
  * \brief   Find the first occurrence of an element starting at a position of the array.
  * \param   a             the array whose element is to be found
@@ -167,10 +289,90 @@ array_rc_e array_swap(array_s *a, int pos1, int pos2);
  * \param   elem_compare  pointer to a callback function used to compare the 'example' element
  *                        to the others in the array; it must return 0 if the provided element
  *                        is 'equal' to the element stored in the array, and non-zero otherwise
- * \return  the position where the element was found, -1 otherwise
+ * \return  the position where the element was found, -1 otherwise (or if the position found
+ *          can't be represented as an 'int')
  */
 int array_find_next(array_s *a, void *elem, int start_pos, int (*elem_compare)(void *, void *));
 
+/**
+ * \brief   Find the first occurrence of an element starting at a position of the array, given as a
+ *          'size_t' index.
+ * \param   a             the array whose element is to be found
+ * \param   elem          an 'example' element to be compared to every other in the array
+ * \param   start_pos     the starting position of the array the search will take place
+ * \param   elem_compare  pointer to a callback function used to compare the elements, the same
+ *                        way as for 'array_find_next'
+ * \return  the position where the element was found, ARRAY_POS_NONE otherwise
+ */
+size_t array_find_next_idx(array_s *a, void *elem, size_t start_pos,
+                           int (*elem_compare)(void *, void *));
+
+/**
+ * \brief   Sort the array elements in place, in ascending order, with an introsort (a quicksort
+ *          which falls back to heapsort on bad partitions, and to insertion sort on short runs),
+ *          without allocating any extra memory. The sort is not stable.
+ * \param   a             the array whose elements are to be sorted
+ * \param   elem_compare  pointer to a callback function used to compare two elements; it must
+ *                        return 0 if they're 'equal', > 0 if the second element is 'greater'
+ *                        than the first one, or < 0 otherwise
+ * \return  the return code for the sort operation
+ */
+array_rc_e array_sort(array_s *a, int (*elem_compare)(void *, void *));
+
+/**
+ * \brief   Sort the array elements by an unsigned integer key, in ascending order, with a stable
+ *          LSD radix sort. It allocates a temporary buffer as large as the array.
+ * \param   a         the array whose elements are to be sorted
+ * \param   elem_key  pointer to a callback function which extracts the key of an element
+ * \return  the return code for the sort operation
+ */
+array_rc_e array_sort_by_key(array_s *a, uint64_t (*elem_key)(void *));
+
+/**
+ * \brief   Find the first position of a sorted array whose element is not 'less' than a given
+ *          element, by binary search.
+ * \param   a             the array, sorted in ascending order, where the search will take place
+ * \param   elem          an 'example' element to be compared to the elements in the array
+ * \param   elem_compare  pointer to a callback function used to compare the elements in the
+ *                        array to the 'example' element, the same way as for 'array_sort'
+ * \return  the position found, which is the no. of elements if all of them are 'less' than the
+ *          'example' element (or zero if the array or the callback function is null)
+ */
+size_t array_lower_bound(array_s *a, void *elem, int (*elem_compare)(void *, void *));
+
+/**
+ * \brief   Find the first position of a sorted array whose element is 'greater' than a given
+ *          element, by binary search.
+ * \param   a             the array, sorted in ascending order, where the search will take place
+ * \param   elem          an 'example' element to be compared to the elements in the array
+ * \param   elem_compare  pointer to a callback function used to compare the elements in the
+ *                        array to the 'example' element, the same way as for 'array_sort'
+ * \return  the position found, which is the no. of elements if none of them is 'greater' than the
+ *          'example' element (or zero if the array or the callback function is null)
+ */
+size_t array_upper_bound(array_s *a, void *elem, int (*elem_compare)(void *, void *));
+
+/**
+ * \brief   Find the first occurrence of an element in a sorted array, by binary search.
+ * \param   a             the array, sorted in ascending order, where the search will take place
+ * \param   elem          an 'example' element to be compared to the elements in the array
+ * \param   elem_compare  pointer to a callback function used to compare the elements in the
+ *                        array to the 'example' element, the same way as for 'array_sort'
+ * \return  the position where the element was found, ARRAY_POS_NONE otherwise
+ */
+size_t array_binary_search(array_s *a, void *elem, int (*elem_compare)(void *, void *));
+
+/**
+ * \brief   Insert an element onto a sorted array, keeping it sorted. The element is inserted after
+ *          any 'equal' elements already stored.
+ * \param   a             the array, sorted in ascending order, whose element is to be inserted onto
+ * \param   elem          the element to be inserted
+ * \param   elem_compare  pointer to a callback function used to compare the elements, the same
+ *                        way as for 'array_sort'
+ * \return  the return code for the insert operation
+ */
+array_rc_e array_insert_sorted(array_s *a, void *elem, int (*elem_compare)(void *, void *));
+
 /**
  * \brief   Traverse all the array elements from front to back, applying the 'elem_visit'
  *          callback function to all its elements.
@@ -181,16 +383,53 @@ int array_find_next(array_s *a, void *elem, int start_pos, int (*elem_compare)(v
 array_rc_e array_traverse(array_s *a, void (*elem_visit)(void *));
 
 /**
- * \brief   Deallocate ('destroy') all the nodes in the array, including its elements (if an
- *          'elem_destroy' callback function is provided), making the array empty.
- * \param   a             the array whose are to be 'destroyed'
+ * \brief   Traverse all the array elements in parallel, splitting them into contiguous chunks of
+ *          at least ARRAY_PARALLEL_MIN_GRAIN elements, each one visited by its own thread. The
+ *          order in which the elements are visited is unspecified, so the 'elem_visit' callback
+ *          function must be safe to be called concurrently for distinct elements, and the array
+ *          must not be modified during the traversal.
+ * \param   a           the array to be traversed by
+ * \param   elem_visit  pointer to a callback function which 'visits' all elems. in the array
+ * \param   nthreads    the maximum no. of threads to be used (zero for one per online processor)
+ * \return  the return code for the traversal operation
+ */
+array_rc_e array_parallel_for(array_s *a, void (*elem_visit)(void *), size_t nthreads);
+
+/**
+ * \brief   Reduce all the array elements to a single value in parallel. Every thread accumulates
+ *          a contiguous chunk of elements onto its own copy of the 'identity' accumulator, by
+ *          means of the 'elem_accumulate' callback function, then all the partial accumulators are
+ *          combined into the result from front to back, by means of the 'acc_combine' one.
+ * \param   a                the array to be reduced
+ * \param   elem_accumulate  pointer to a callback function which accumulates ('maps' and adds)
+ *                           an element onto an accumulator, being given both of them, in order
+ *                           ('elem. callback null' if it's null)
+ * \param   acc_combine      pointer to a callback function which combines the 2nd. accumulator
+ *                           given onto the 1st. one ('elem. callback null' if it's null)
+ * \param   identity         pointer to the initial value of every accumulator ('elem. null' if
+ *                           it's null)
+ * \param   acc_size         the size (in bytes) of an accumulator
+ * \param   result           pointer to where the reduced value is to be stored; it's set to the
+ *                           'identity' value if the array is empty ('elem. null' if it's null)
+ * \param   nthreads         the maximum no. of threads to be used (zero for one per online
+ *                           processor)
+ * \return  the return code for the reduce operation
+ */
+array_rc_e array_parallel_reduce(array_s *a, void (*elem_accumulate)(void *, void *),
+                                 void (*acc_combine)(void *, void *), const void *identity,
+                                 size_t acc_size, void *result, size_t nthreads);
+
+/**
+ * \brief   Remove all the elements from the array, deallocating them (if an 'elem_destroy'
+ *          callback function is provided), making the array empty.
+ * \param   a             the array whose elements are to be 'destroyed'
  * \param   elem_destroy  a pointer to a callback func. which deallocates all the array elements
  * \return  the return code for the 'destroy' operation
  */
 array_rc_e array_clear(array_s *a, void (*elem_destroy)(void **));
 
 /**
- * \brief   Deallocate ('destroy') all the nodes in the array and the array itself.
+ * \brief   Deallocate ('destroy') all the elements in the array and the array itself.
  * \param   a             pointer to the array to be 'destroyed'
  * \param   elem_destroy  a pointer to a callback func. which deallocates all the array elements
  * \return  the return code for the 'destroy' operation
@@ -10,27 +10,63 @@ extern "C" {
 #endif
 
 #include <stddef.h>
-#include "libdatastructures/list/doubly-linked-list.h"
+#include "libdatastructures/pool/node-pool.h"
 
 /* ************************************************************************************************/
 
-/** Deque data structure type, which is actually a "wrapper" of a circ. doubly linked list */
-typedef d_l_list_s deque_s;
+#ifndef DEQUE_BLOCK_LENGTH
+/** No. of elements stored in every block of a deque (it may be overridden when building the
+    library) */
+#define DEQUE_BLOCK_LENGTH 64
+#endif
+
+/**
+ * Deque data structure, which stores its elements in fixed-size blocks, pointed to (in order) by a
+ * 'map' of blocks, as the C++ 'std::deque' does. Pushing or popping elements at both ends is
+ * amortized constant time, and so is picking an element at any position. A block is only
+ * allocated when the blocks at an end are full, and an emptied block is kept as a spare one (so
+ * pushing and popping elements around the boundary of a block doesn't call the allocator).
+ */
+struct deque {
+    /** Pointer to the map of blocks, whose used entries are contiguous */
+    void ***map;
+    /** Total length of the map (no. of entries) */
+    size_t map_length;
+    /** Entry of the map pointing to the first block */
+    size_t first_block;
+    /** No. of blocks in use, pointed to by the map from its 'first_block' entry onwards */
+    size_t nblocks;
+    /** Slot of the first block where the first element (the 'front' of the deque) is stored */
+    size_t front;
+    /** No. of elements stored in the deque */
+    size_t count;
+    /** An empty block kept for reuse, or null */
+    void **spare;
+    /** Pool the blocks are allocated out of, or null if they're allocated by 'malloc' */
+    node_pool_s *pool;
+};
+
+/** Deque data structure type */
+typedef struct deque deque_s;
 
 /** Deque operations return codes */
 enum deque_rc {
     /** No error */
-    DEQUE_RC_OK = D_L_LIST_RC_OK,
+    DEQUE_RC_OK = 0,
     /** Deque is null */
-    DEQUE_RC_NULL = D_L_LIST_RC_NULL,
+    DEQUE_RC_NULL = -1,
     /** Deque is empty (contains no elements) */
-    DEQUE_RC_EMPTY = D_L_LIST_RC_EMPTY,
+    DEQUE_RC_EMPTY = -2,
     /** The element to be pushed is null */
-    DEQUE_RC_ELEM_NULL = D_L_LIST_RC_ELEM_NULL,
+    DEQUE_RC_ELEM_NULL = -3,
     /** The callback function to operate on the element is null */
-    DEQUE_RC_ELEM_CB_NULL = D_L_LIST_RC_ELEM_CB_NULL,
-    /** The allocation of a new node has failed */
-    DEQUE_RC_NODE_ALLOC_ERR = D_L_LIST_RC_NODE_ALLOC_ERR
+    DEQUE_RC_ELEM_CB_NULL = -4,
+    /** The allocation of a new block (or of a larger map) has failed */
+    DEQUE_RC_NODE_ALLOC_ERR = -5,
+    /** The deque must be empty for the operation */
+    DEQUE_RC_NOT_EMPTY = -6,
+    /** The nodes of the pool are too small to store the deque blocks */
+    DEQUE_RC_INVALID_POOL = -7
 };
 
 /** Deque operation return code type */
@@ -50,6 +86,16 @@ void deque_init(deque_s *deque);
  */
 deque_s *deque_new(void);
 
+/**
+ * \brief   Make a deque allocate its blocks out of a node pool, which may be shared by many
+ *          deques (or null, so they're allocated by 'malloc'). The pool must outlive the blocks of
+ *          the deque, and it's only allowed to be set while the deque is empty.
+ * \param   deque  the deque whose pool is to be set
+ * \param   pool   the pool, whose node size must be at least 'DEQUE_BLOCK_LENGTH * sizeof(void *)'
+ * \return  the return code for the operation
+ */
+deque_rc_e deque_set_pool(deque_s *deque, node_pool_s *pool);
+
 /**
  * \brief   Push and element onto the front (beginning) of the deque.
  * \param   deque  the deque whose element is to be pushed
@@ -96,6 +142,15 @@ void *deque_pick_front(deque_s *deque);
  */
 void *deque_pick_back(deque_s *deque);
 
+/**
+ * \brief   Get ('pick') the element at a position of the deque without actually removing it, in
+ *          constant time.
+ * \param   deque  the deque whose element is to be picked
+ * \param   pos    the position of the element, counted from the front of the deque
+ * \return  the element picked from the deque, or null if the position is out of its bounds
+ */
+void *deque_pick_at(deque_s *deque, size_t pos);
+
 /**
  * \brief   Remove ('pop') an element from the front of the deque.
  * \param   deque  the deque whose element is to be removed from its front
@@ -111,16 +166,16 @@ void *deque_pop_front(deque_s *deque);
 void *deque_pop_back(deque_s *deque);
 
 /**
- * \brief   Deallocate ('destroy') all the nodes in the deque, including its elements (if an
+ * \brief   Deallocate ('destroy') all the blocks in the deque, including its elements (if an
  *          'elem_destroy' callback function is provided), making the deque empty.
- * \param   deque         the deque whose nodes are to be 'destroyed'
+ * \param   deque         the deque whose blocks are to be 'destroyed'
  * \param   elem_destroy  a pointer to the callback func. which deallocates all the deque elems.
  * \return  the return code for the deallocation operation
  */
 deque_rc_e deque_clear(deque_s *deque, void (*elem_destroy)(void **));
 
 /**
- * \brief   Deallocate ('destroy') all the nodes in the deque and the deque itself.
+ * \brief   Deallocate ('destroy') all the blocks in the deque and the deque itself.
  * \param   deque         pointer to the deque to be 'destroyed'
  * \param   elem_destroy  a pointer to a callback function which deallocates all the deque elements
  * \return  the return code for the 'destroy' operation
@@ -0,0 +1,165 @@
+/**
+ * \file   ws-deque.h
+ * \brief  Lock-free work-stealing deque (Chase-Lev deque) - struct. and type definitions and
+ *         functions declarations
+ */
+#ifndef LIBDATASTRUCTURES_WS_DEQUE_H
+#define LIBDATASTRUCTURES_WS_DEQUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+/* ************************************************************************************************/
+
+#ifndef WS_DEQUE_CACHE_LINE
+/** Assumed size of a cache line, so the owner and the thieves indices don't share one */
+#define WS_DEQUE_CACHE_LINE 64
+#endif
+
+/** Circular array storing the elements of a work-stealing deque */
+struct ws_deque_array {
+    /** The length of the array, which is a power of two */
+    size_t length;
+    /** The array the elements were stored in before this one, retired when the deque grew */
+    struct ws_deque_array *prev;
+    /** The slots of the array, where the element at index 'i' is stored at 'i % length' */
+    _Atomic(void *) elems[];
+};
+
+/** Work-stealing deque array type */
+typedef struct ws_deque_array ws_deque_array_s;
+
+/**
+ * Lock-free work-stealing deque (D. Chase and Y. Lev's design, with the C11 memory model ordering
+ * of N. M. Lê et al.), the building block of a work-stealing task scheduler. A single 'owner'
+ * thread pushes and pops elements at the bottom of the deque (as a stack), without any
+ * read-modify-write atomic operation unless it pops the last element, while any number of
+ * 'thief' threads steal elements from the top of the deque with a compare-and-swap each.
+ *
+ * The elements are stored in a circular array, which is replaced by one twice as long when it
+ * gets full. As a thief may still be reading the retired array, the retired arrays are only
+ * deallocated along with the deque.
+ */
+struct ws_deque {
+    /** The index of the top element, where the thieves steal elements from */
+    atomic_ptrdiff_t top;
+    /** Padding, so the owner and the thieves indices don't share a cache line */
+    char pad0[WS_DEQUE_CACHE_LINE];
+    /** The index after the bottom element, where the owner pushes and pops elements at */
+    atomic_ptrdiff_t bottom;
+    /** The current array of the deque */
+    _Atomic(ws_deque_array_s *) array;
+    /** Padding, so the owner data doesn't share a cache line with other data */
+    char pad1[WS_DEQUE_CACHE_LINE];
+};
+
+/** Work-stealing deque data structure type */
+typedef struct ws_deque ws_deque_s;
+
+/** Work-stealing deque operations return codes */
+enum ws_deque_rc {
+    /** No error */
+    WS_DEQUE_RC_OK = 0,
+    /** Deque is null */
+    WS_DEQUE_RC_NULL = -1,
+    /** Deque is empty (contains no elements) */
+    WS_DEQUE_RC_EMPTY = -2,
+    /** The element to be pushed is null */
+    WS_DEQUE_RC_ELEM_NULL = -3,
+    /** The callback function to operate on the element is null */
+    WS_DEQUE_RC_ELEM_CB_NULL = -4,
+    /** The allocation of a (longer) array has failed */
+    WS_DEQUE_RC_NODE_ALLOC_ERR = -5,
+    /** The steal has lost a race against another thread for the top element (it may be retried) */
+    WS_DEQUE_RC_ABORT = -6
+};
+
+/** Work-stealing deque operation return code type */
+typedef enum ws_deque_rc ws_deque_rc_e;
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Initialize a work-stealing deque, allocating its array (if that fails, or if the
+ *         capacity is too large to be allocated at all, it's allocated as the first element is
+ *         pushed).
+ * \param  deque     pointer to the deque to be initialized
+ * \param  capacity  the initial length of the array, rounded up to a power of two (and to at
+ *                   least 2)
+ */
+void ws_deque_init(ws_deque_s *deque, size_t capacity);
+
+/**
+ * \brief   Create and initialize a work-stealing deque.
+ * \param   capacity  the initial length of the array, rounded up to a power of two (and to at
+ *                    least 2)
+ * \return  a pointer to the allocated deque
+ */
+ws_deque_s *ws_deque_new(size_t capacity);
+
+/**
+ * \brief   Insert ('push') an element at the bottom of the deque, growing its array if it's
+ *          full. It may only be called by the owner thread.
+ * \param   deque  the deque where the element is to be pushed
+ * \param   elem   the element to be pushed
+ * \return  the return code for the operation
+ */
+ws_deque_rc_e ws_deque_push_bottom(ws_deque_s *deque, void *elem);
+
+/**
+ * \brief   Remove ('pop') the element from the bottom of the deque (the most recently pushed
+ *          one). It may only be called by the owner thread.
+ * \param   deque  the deque from where the element is to be popped
+ * \return  the element removed from the deque, or null if the deque is null or empty (or if a
+ *          thief has stolen its last element meanwhile)
+ */
+void *ws_deque_pop_bottom(ws_deque_s *deque);
+
+/**
+ * \brief   Remove ('steal') the element from the top of the deque (the least recently pushed
+ *          one). It may be called by any thread.
+ * \param   deque  the deque from where the element is to be stolen
+ * \param   elem   where the stolen element is to be stored
+ * \return  the return code for the operation ('abort' if another thread has taken the element
+ *          meanwhile, so the steal may be retried)
+ */
+ws_deque_rc_e ws_deque_steal_top(ws_deque_s *deque, void **elem);
+
+/**
+ * \brief   Get the number of elements in the deque. While other threads are operating on the
+ *          deque, it's only a snapshot, which may already be stale when returned.
+ * \param   deque  the deque whose number of elements is to be got
+ * \return  the number of elements in the deque
+ */
+size_t ws_deque_count(ws_deque_s *deque);
+
+/**
+ * \brief   Remove all the elements from the deque, deallocating them (if an 'elem_destroy'
+ *          callback function is provided). No other thread may operate on the deque meanwhile.
+ * \param   deque         the deque whose elements are to be removed
+ * \param   elem_destroy  the callback function to deallocate every element of the deque
+ * \return  the return code for the operation
+ */
+ws_deque_rc_e ws_deque_clear(ws_deque_s *deque, void (*elem_destroy)(void **));
+
+/**
+ * \brief   Deallocate ('destroy') all the elements in the deque (if an 'elem_destroy' callback
+ *          function is provided), its current and retired arrays and the deque itself. No other
+ *          thread may operate on the deque meanwhile.
+ * \param   deque         pointer to the deque to be destroyed
+ * \param   elem_destroy  the callback function to deallocate every element of the deque
+ * \return  the return code for the operation
+ */
+ws_deque_rc_e ws_deque_destroy(ws_deque_s **deque, void (*elem_destroy)(void **));
+
+/* ************************************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LIBDATASTRUCTURES_WS_DEQUE_H */
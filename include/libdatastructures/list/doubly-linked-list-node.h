@@ -9,6 +9,8 @@
 extern "C" {
 #endif
 
+#include "libdatastructures/pool/node-pool.h"
+
 /* ************************************************************************************************/
 
 /** Forward declaration of doubly linked list node structure */
@@ -43,6 +45,22 @@ d_l_list_node_s *d_l_list_node_new(void *elem);
  */
 void *d_l_list_node_destroy(d_l_list_node_s **node);
 
+/**
+ * \brief   Create and initialize a circ. doubly linked list node, allocating it out of a node pool.
+ * \param   elem  the element to be stored on the node
+ * \param   pool  the pool the node is to be allocated out of (if null, it's allocated by 'malloc')
+ * \return  the pointer to the allocated node
+ */
+d_l_list_node_s *d_l_list_node_new_pooled(void *elem, node_pool_s *pool);
+
+/**
+ * \brief   "Destroy" (deallocate) a circ. doubly linked list node, giving it back to a node pool.
+ * \param   node  pointer to the var. storing the node to be destroyed
+ * \param   pool  the pool the node was allocated out of (if null, it's deallocated by 'free')
+ * \return  the element stored on the node; it's the user's responsibility to deallocate it
+ */
+void *d_l_list_node_destroy_pooled(d_l_list_node_s **node, node_pool_s *pool);
+
 /* ************************************************************************************************/
 
 #ifdef __cplusplus
@@ -9,6 +9,7 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stddef.h>
 #include "libdatastructures/list/doubly-linked-list-node.h"
 
@@ -20,11 +21,28 @@ struct doubly_linked_list {
     d_l_list_node_s *front;
     /** No. of nodes stored in the list */
     size_t count;
+    /** Pool the nodes are allocated out of, or null if they're allocated by 'malloc' */
+    node_pool_s *pool;
 };
 
 /** Doubly linked list type */
 typedef struct doubly_linked_list d_l_list_s;
 
+/**
+ * Doubly linked list cursor structure, which points to a node of a list (its 'current' node) or
+ * past the back of it (its 'end'). A cursor is invalidated by any change to its list which isn't
+ * done through the cursor itself.
+ */
+struct doubly_linked_list_cursor {
+    /** Pointer to the list the cursor iterates over */
+    d_l_list_s *list;
+    /** Pointer to the current node, or null if the cursor is at the end of the list */
+    d_l_list_node_s *curr;
+};
+
+/** Doubly linked list cursor type */
+typedef struct doubly_linked_list_cursor d_l_list_cursor_s;
+
 /** Doubly linked list operations return codes */
 enum doubly_linked_list_rc {
     /** No error */
@@ -39,6 +57,14 @@ enum doubly_linked_list_rc {
     D_L_LIST_RC_ELEM_CB_NULL = -4,
     /** The allocation of a new node has failed */
     D_L_LIST_RC_NODE_ALLOC_ERR = -5,
+    /** The list must be empty for the operation */
+    D_L_LIST_RC_NOT_EMPTY = -6,
+    /** The nodes of the pool are too small to store the list nodes */
+    D_L_LIST_RC_INVALID_POOL = -7,
+    /** The lists allocate their nodes out of different pools, so they can't exchange nodes */
+    D_L_LIST_RC_POOL_MISMATCH = -8,
+    /** The position or the node range is out of the list bounds */
+    D_L_LIST_RC_OUT_OF_RANGE = -9,
 };
 
 /** Doubly linked list operation return code type */
@@ -58,6 +84,16 @@ void d_l_list_init(d_l_list_s *list);
  */
 d_l_list_s *d_l_list_new(void);
 
+/**
+ * \brief   Make a circular doubly linked list allocate its nodes out of a node pool, which may be
+ *          shared by many lists (or null, so they're allocated by 'malloc'). The pool must outlive
+ *          the nodes of the list, and it's only allowed to be set while the list is empty.
+ * \param   list  the list whose pool is to be set
+ * \param   pool  the pool, whose node size must be at least 'sizeof(d_l_list_node_s)'
+ * \return  the return code for the operation
+ */
+d_l_list_rc_e d_l_list_set_pool(d_l_list_s *list, node_pool_s *pool);
+
 /**
  * \brief   Insert a non-null element to the 'front' (beginning) of a circ. doubly linked list.
  * \param   list  the list whose element is to be inserted onto
@@ -74,6 +110,68 @@ d_l_list_rc_e d_l_list_insert_front(d_l_list_s *list, void *elem);
  */
 d_l_list_rc_e d_l_list_insert_back(d_l_list_s *list, void *elem);
 
+/**
+ * \brief   Move all the nodes of a circ. doubly linked list to the 'back' (end) of another one, in
+ *          constant time and without (de)allocating any node, making the former list empty.
+ * \param   dst  the list the nodes are to be moved onto
+ * \param   src  the list whose nodes are to be moved, which must use the same pool as 'dst'
+ * \return  the return code for the concatenation operation
+ */
+d_l_list_rc_e d_l_list_concat(d_l_list_s *dst, d_l_list_s *src);
+
+/**
+ * \brief   Move a range of nodes of a circ. doubly linked list before a node of another one (or of
+ *          the same one), without (de)allocating any node. The nodes are relinked in constant time,
+ *          though the range is walked once so as to count (and validate) its nodes.
+ * \param   dst    the list the nodes are to be moved onto
+ * \param   pos    the node of 'dst' the range is to be moved before, or null to move it to the back
+ * \param   src    the list whose nodes are to be moved, which must use the same pool as 'dst'
+ * \param   first  the first node of the range to be moved
+ * \param   last   the last node of the range, which must not come before 'first' in 'src'; if both
+ *                 lists are the same one, 'pos' must not be in the range
+ * \return  the return code for the splice operation
+ */
+d_l_list_rc_e d_l_list_splice(d_l_list_s *dst, d_l_list_node_s *pos, d_l_list_s *src,
+                              d_l_list_node_s *first, d_l_list_node_s *last);
+
+/**
+ * \brief   Split a circ. doubly linked list in two, moving its nodes from a position up to the end
+ *          onto another list, without (de)allocating any node. The node at the position is reached
+ *          from the nearest end of the list.
+ * \param   list  the list to be split
+ * \param   pos   the position of the first node to be moved, up to the number of nodes of the list
+ * \param   out   the empty list the nodes are to be moved onto, which must use the same pool as
+ *                'list'
+ * \return  the return code for the split operation
+ */
+d_l_list_rc_e d_l_list_split_at(d_l_list_s *list, size_t pos, d_l_list_s *out);
+
+/**
+ * \brief   Sort the elements of a circ. doubly linked list in place, in ascending order, with a
+ *          stable bottom-up merge sort which only relinks the existing nodes, so it doesn't
+ *          (de)allocate any memory.
+ * \param   list          the list whose elements are to be sorted
+ * \param   elem_compare  pointer to a callback function used to compare two elements; it must
+ *                        return 0 if they're 'equal', > 0 if the second element is 'greater'
+ *                        than the first one, or < 0 otherwise
+ * \return  the return code for the sort operation
+ */
+d_l_list_rc_e d_l_list_sort(d_l_list_s *list, int (*elem_compare)(void *, void *));
+
+/**
+ * \brief   Merge all the nodes of a sorted circ. doubly linked list onto another sorted one, in
+ *          ascending order, making the former list empty. The merge is stable, i.e. 'equal'
+ *          elements of 'dst' come before those of 'src', and it doesn't (de)allocate any node.
+ * \param   dst           the sorted list the nodes are to be merged onto
+ * \param   src           the sorted list whose nodes are to be merged, which must use the same
+ *                        pool as 'dst'
+ * \param   elem_compare  pointer to a callback function used to compare two elements, the same
+ *                        way as for 'd_l_list_sort'
+ * \return  the return code for the merge operation
+ */
+d_l_list_rc_e d_l_list_merge(d_l_list_s *dst, d_l_list_s *src,
+                             int (*elem_compare)(void *, void *));
+
 /**
  * \brief   Traverse all the list nodes in a forward direction, from the beginning to the end,
  *          applying the 'elem_visit' callback function to all its elements.
@@ -92,6 +190,93 @@ d_l_list_rc_e d_l_list_traverse_forward(d_l_list_s *list, void (*elem_visit)(voi
  */
 d_l_list_rc_e d_l_list_traverse_backward(d_l_list_s *list, void (*elem_visit)(void *));
 
+/**
+ * \brief   Find the first element of a circ. doubly linked list which is 'equal' to a given one.
+ * \param   list          the list whose element is to be found
+ * \param   elem          an 'example' element to be compared to every other in the list
+ * \param   elem_compare  pointer to a callback function used to compare the 'example' element
+ *                        to the others in the list; it must return 0 if the provided element
+ *                        is 'equal' to the element stored in the list, and non-zero otherwise
+ * \return  the element found, or null if there's none
+ */
+void *d_l_list_find(d_l_list_s *list, void *elem, int (*elem_compare)(void *, void *));
+
+/**
+ * \brief   Remove all the elements of a circ. doubly linked list which match a predicate, in a
+ *          single pass, deallocating them (if an 'elem_destroy' callback function is provided).
+ * \param   list          the list whose elements are to be removed
+ * \param   elem_match    pointer to a callback function which tells whether an element is to be
+ *                        removed
+ * \param   elem_destroy  a pointer to a callback function which deallocates the removed elements
+ * \return  the return code for the remove operation
+ */
+d_l_list_rc_e d_l_list_remove_if(d_l_list_s *list, bool (*elem_match)(void *),
+                                 void (*elem_destroy)(void **));
+
+/**
+ * \brief   Point a cursor to the 'front' (beginning) of a circ. doubly linked list, or to its
+ *          end if the list is empty.
+ * \param   cursor  the cursor to be pointed
+ * \param   list    the list the cursor is to iterate over
+ * \return  the return code for the operation
+ */
+d_l_list_rc_e d_l_list_cursor_begin(d_l_list_cursor_s *cursor, d_l_list_s *list);
+
+/**
+ * \brief   Point a cursor to the end of a circ. doubly linked list (past its 'back' node).
+ * \param   cursor  the cursor to be pointed
+ * \param   list    the list the cursor is to iterate over
+ * \return  the return code for the operation
+ */
+d_l_list_rc_e d_l_list_cursor_end(d_l_list_cursor_s *cursor, d_l_list_s *list);
+
+/**
+ * \brief   Move a cursor to the next node of its list, or to the end if it's at the back node.
+ * \param   cursor  the cursor to be moved
+ * \return  the return code for the operation
+ */
+d_l_list_rc_e d_l_list_cursor_next(d_l_list_cursor_s *cursor);
+
+/**
+ * \brief   Move a cursor to the previous node of its list, or to the back node if it's at the end.
+ * \param   cursor  the cursor to be moved
+ * \return  the return code for the operation
+ */
+d_l_list_rc_e d_l_list_cursor_prev(d_l_list_cursor_s *cursor);
+
+/**
+ * \brief   Get the element of the current node of a cursor.
+ * \param   cursor  the cursor whose element is to be gotten
+ * \return  the element, or null if the cursor is at the end of the list
+ */
+void *d_l_list_cursor_get(d_l_list_cursor_s *cursor);
+
+/**
+ * \brief   Remove the current node of a cursor from its list, moving the cursor to the next node.
+ * \param   cursor  the cursor whose current node is to be removed
+ * \return  the element removed from the list (or null if the cursor is at the end of the list);
+ *          it's the user's responsibility to deallocate it
+ */
+void *d_l_list_cursor_remove_current(d_l_list_cursor_s *cursor);
+
+/**
+ * \brief   Insert a non-null element before the current node of a cursor (or at the 'back' of the
+ *          list, if the cursor is at its end). The cursor stays at its current node.
+ * \param   cursor  the cursor the element is to be inserted before
+ * \param   elem    the element to be inserted onto the list
+ * \return  the return code for the insert operation
+ */
+d_l_list_rc_e d_l_list_cursor_insert_before(d_l_list_cursor_s *cursor, void *elem);
+
+/**
+ * \brief   Insert a non-null element after the current node of a cursor. The cursor stays at its
+ *          current node.
+ * \param   cursor  the cursor the element is to be inserted after
+ * \param   elem    the element to be inserted onto the list
+ * \return  the return code for the insert operation
+ */
+d_l_list_rc_e d_l_list_cursor_insert_after(d_l_list_cursor_s *cursor, void *elem);
+
 /**
  * \brief   Remove the element at the 'front' (beginning) of the circ. doubly linked list.
  * \param   list  the list whose element is to be removed
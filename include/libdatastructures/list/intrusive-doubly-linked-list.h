@@ -0,0 +1,213 @@
+/**
+ * \file   intrusive-doubly-linked-list.h
+ * \brief  Circ. intrusive doubly linked list - struct. and type definitions and func. declarations
+ */
+#ifndef LIBDATASTRUCTURES_INTRUSIVE_DOUBLY_LINKED_LIST_H
+#define LIBDATASTRUCTURES_INTRUSIVE_DOUBLY_LINKED_LIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* ************************************************************************************************/
+
+/** Forward declaration of doubly linked list link structure */
+struct doubly_linked_list_link;
+
+/** Doubly linked list link type */
+typedef struct doubly_linked_list_link d_l_list_link_s;
+
+/**
+ * Doubly linked list link structure, to be embedded in the user structures stored in an intrusive
+ * list, so the list threads through them without allocating any node. A structure may embed
+ * several links to be stored in several lists at once.
+ */
+struct doubly_linked_list_link {
+    /** Pointer to the previous link in the list, or null if the link is not in any list */
+    d_l_list_link_s *prev;
+    /** Pointer to the next link in the list, or null if the link is not in any list */
+    d_l_list_link_s *next;
+};
+
+/**
+ * Get a pointer to the user structure which embeds a link.
+ * \param  link    pointer to the link
+ * \param  type    the type of the user structure
+ * \param  member  the name of the link member of the user structure
+ */
+#define D_L_LIST_CONTAINER_OF(link, type, member) \
+    ((type *)(void *)((char *)(link) - offsetof(type, member)))
+
+/** Intrusive doubly linked list structure */
+struct intrusive_doubly_linked_list {
+    /** Pointer to the first link (the 'front' of the list) */
+    d_l_list_link_s *front;
+    /** No. of links stored in the list */
+    size_t count;
+};
+
+/** Intrusive doubly linked list type */
+typedef struct intrusive_doubly_linked_list i_d_l_list_s;
+
+/** Intrusive doubly linked list operations return codes */
+enum intrusive_doubly_linked_list_rc {
+    /** No error */
+    I_D_L_LIST_RC_OK = 0,
+    /** List is null */
+    I_D_L_LIST_RC_NULL = -1,
+    /** List is empty (contains no elements) */
+    I_D_L_LIST_RC_EMPTY = -2,
+    /** The link of the element to be inserted or removed is null */
+    I_D_L_LIST_RC_ELEM_NULL = -3,
+    /** The callback function to operate on the element is null */
+    I_D_L_LIST_RC_ELEM_CB_NULL = -4,
+    /** The link of the element to be inserted is already in a list */
+    I_D_L_LIST_RC_ELEM_LINKED = -5,
+    /** The link of the element to be removed is not in any list */
+    I_D_L_LIST_RC_ELEM_NOT_LINKED = -6,
+};
+
+/** Intrusive doubly linked list operation return code type */
+typedef enum intrusive_doubly_linked_list_rc i_d_l_list_rc_e;
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Initialize a doubly linked list link, marking it as not being in any list. Every link
+ *         must be initialized before being inserted onto a list for the first time.
+ * \param  link  pointer to the link to be initialized
+ */
+void d_l_list_link_init(d_l_list_link_s *link);
+
+/**
+ * \brief   Check whether a doubly linked list link is in a list.
+ * \param   link  pointer to the link to be checked
+ * \return  true if the link is in a list, false otherwise
+ */
+bool d_l_list_link_is_linked(d_l_list_link_s *link);
+
+/**
+ * \brief  Initialize a circular intrusive doubly linked list.
+ * \param  list  pointer to the list to be initialized
+ */
+void i_d_l_list_init(i_d_l_list_s *list);
+
+/**
+ * \brief   Create and initialize a new circular intrusive doubly linked list.
+ * \return  a pointer to the allocated list
+ */
+i_d_l_list_s *i_d_l_list_new(void);
+
+/**
+ * \brief   Insert an element to the 'front' (beginning) of a circ. intrusive doubly linked list,
+ *          by its link, without allocating anything.
+ * \param   list  the list whose element is to be inserted onto
+ * \param   link  the link of the element to be inserted, which must not be in any list
+ * \return  the return code for the insert operation
+ */
+i_d_l_list_rc_e i_d_l_list_insert_front(i_d_l_list_s *list, d_l_list_link_s *link);
+
+/**
+ * \brief   Insert an element to the 'back' (end) of a circ. intrusive doubly linked list, by its
+ *          link, without allocating anything.
+ * \param   list  the list whose element is to be inserted onto
+ * \param   link  the link of the element to be inserted, which must not be in any list
+ * \return  the return code for the insert operation
+ */
+i_d_l_list_rc_e i_d_l_list_insert_back(i_d_l_list_s *list, d_l_list_link_s *link);
+
+/**
+ * \brief   Get the number of elements stored in the list.
+ * \param   list  the list whose number of elements is to be gotten
+ * \return  the number of elements stored in the list
+ */
+size_t i_d_l_list_count(i_d_l_list_s *list);
+
+/**
+ * \brief   Get the link of the element at the 'front' (beginning) of the list.
+ * \param   list  the list whose first element is to be gotten
+ * \return  the link of the first element, or null if the list is empty
+ */
+d_l_list_link_s *i_d_l_list_front(i_d_l_list_s *list);
+
+/**
+ * \brief   Get the link of the element at the 'back' (end) of the list.
+ * \param   list  the list whose last element is to be gotten
+ * \return  the link of the last element, or null if the list is empty
+ */
+d_l_list_link_s *i_d_l_list_back(i_d_l_list_s *list);
+
+/**
+ * \brief   Traverse all the list elements in a forward direction, from the beginning to the end,
+ *          applying the 'link_visit' callback function to all their links.
+ * \param   list        the list to be traversed by
+ * \param   link_visit  pointer to a callback function which 'visits' all the links in the list; it
+ *                      must not insert or remove any element onto or from the list
+ * \return  the return code for the traversal operation
+ */
+i_d_l_list_rc_e i_d_l_list_traverse_forward(i_d_l_list_s *list,
+                                            void (*link_visit)(d_l_list_link_s *));
+
+/**
+ * \brief   Traverse all the list elements in a backward direction, from the end to the beginning,
+ *          applying the 'link_visit' callback function to all their links.
+ * \param   list        the list to be traversed by
+ * \param   link_visit  pointer to a callback function which 'visits' all the links in the list; it
+ *                      must not insert or remove any element onto or from the list
+ * \return  the return code for the traversal operation
+ */
+i_d_l_list_rc_e i_d_l_list_traverse_backward(i_d_l_list_s *list,
+                                             void (*link_visit)(d_l_list_link_s *));
+
+/**
+ * \brief   Remove an arbitrary element from the circ. intrusive doubly linked list, in constant
+ *          time, given only its link.
+ * \param   list  the list whose element is to be removed
+ * \param   link  the link of the element to be removed, which must be in this list
+ * \return  the return code for the remove operation
+ */
+i_d_l_list_rc_e i_d_l_list_remove(i_d_l_list_s *list, d_l_list_link_s *link);
+
+/**
+ * \brief   Remove the element at the 'front' (beginning) of the circ. intrusive doubly linked list.
+ * \param   list  the list whose element is to be removed
+ * \return  the link of the element removed from the list, or null if it's empty
+ */
+d_l_list_link_s *i_d_l_list_remove_front(i_d_l_list_s *list);
+
+/**
+ * \brief   Remove the element at the 'back' (end) of the circ. intrusive doubly linked list.
+ * \param   list  the list whose element is to be removed
+ * \return  the link of the element removed from the list, or null if it's empty
+ */
+d_l_list_link_s *i_d_l_list_remove_back(i_d_l_list_s *list);
+
+/**
+ * \brief   Remove all the elements from the list, applying the 'link_destroy' callback function
+ *          to their links (if it's provided), making the list empty.
+ * \param   list          the list whose elements are to be removed
+ * \param   link_destroy  pointer to a callback function which is given the link of every removed
+ *                        element (e.g. to deallocate the element which embeds it)
+ * \return  the return code for the 'clear' operation
+ */
+i_d_l_list_rc_e i_d_l_list_clear(i_d_l_list_s *list, void (*link_destroy)(d_l_list_link_s *));
+
+/**
+ * \brief   Remove all the elements from the list and deallocate ('destroy') the list itself.
+ * \param   list          pointer to the list to be 'destroyed'
+ * \param   link_destroy  pointer to a callback function which is given the link of every removed
+ *                        element (e.g. to deallocate the element which embeds it)
+ * \return  the return code for the 'destroy' operation
+ */
+i_d_l_list_rc_e i_d_l_list_destroy(i_d_l_list_s **list, void (*link_destroy)(d_l_list_link_s *));
+
+/* ************************************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LIBDATASTRUCTURES_INTRUSIVE_DOUBLY_LINKED_LIST_H */
@@ -9,6 +9,7 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stddef.h>
 #include "libdatastructures/list/singly-linked-list-node.h"
 
@@ -20,11 +21,31 @@ struct singly_linked_list {
     s_l_list_node_s *back;
     /** No. of nodes stored in the list */
     size_t count;
+    /** Pool the nodes are allocated out of, or null if they're allocated by 'malloc' */
+    node_pool_s *pool;
 };
 
 /** Singly linked list type */
 typedef struct singly_linked_list s_l_list_s;
 
+/**
+ * Singly linked list cursor structure, which points to a node of a list (its 'current' node) or
+ * past the back of it (its 'end'). It keeps the node before the current one, so the latter can be
+ * removed in constant time. A cursor is invalidated by any change to its list which isn't done
+ * through the cursor itself.
+ */
+struct singly_linked_list_cursor {
+    /** Pointer to the list the cursor iterates over */
+    s_l_list_s *list;
+    /** Pointer to the node before the current one (or to the back one, at the end of the list) */
+    s_l_list_node_s *prev;
+    /** Pointer to the current node, or null if the cursor is at the end of the list */
+    s_l_list_node_s *curr;
+};
+
+/** Singly linked list cursor type */
+typedef struct singly_linked_list_cursor s_l_list_cursor_s;
+
 /** Singly linked list operations return codes */
 enum singly_linked_list_rc {
     /** No error */
@@ -39,6 +60,14 @@ enum singly_linked_list_rc {
     S_L_LIST_RC_ELEM_CB_NULL = -4,
     /** The allocation of a new node has failed */
     S_L_LIST_RC_NODE_ALLOC_ERR = -5,
+    /** The list must be empty for the operation */
+    S_L_LIST_RC_NOT_EMPTY = -6,
+    /** The nodes of the pool are too small to store the list nodes */
+    S_L_LIST_RC_INVALID_POOL = -7,
+    /** The lists allocate their nodes out of different pools, so they can't exchange nodes */
+    S_L_LIST_RC_POOL_MISMATCH = -8,
+    /** The position is out of the list bounds */
+    S_L_LIST_RC_OUT_OF_RANGE = -9,
 };
 
 /** Singly linked list operation return code type */
@@ -58,6 +87,16 @@ void s_l_list_init(s_l_list_s *list);
  */
 s_l_list_s *s_l_list_new(void);
 
+/**
+ * \brief   Make a circular singly linked list allocate its nodes out of a node pool, which may be
+ *          shared by many lists (or null, so they're allocated by 'malloc'). The pool must outlive
+ *          the nodes of the list, and it's only allowed to be set while the list is empty.
+ * \param   list  the list whose pool is to be set
+ * \param   pool  the pool, whose node size must be at least 'sizeof(s_l_list_node_s)'
+ * \return  the return code for the operation
+ */
+s_l_list_rc_e s_l_list_set_pool(s_l_list_s *list, node_pool_s *pool);
+
 /**
  * \brief   Insert a non-null element to the 'front' (beginning) of a circ. singly linked list.
  * \param   list  the list whose element is to be inserted onto
@@ -74,6 +113,27 @@ s_l_list_rc_e s_l_list_insert_front(s_l_list_s *list, void *elem);
  */
 s_l_list_rc_e s_l_list_insert_back(s_l_list_s *list, void *elem);
 
+/**
+ * \brief   Move all the nodes of a circ. singly linked list to the 'back' (end) of another one, in
+ *          constant time and without (de)allocating any node, making the former list empty.
+ * \param   dst  the list the nodes are to be moved onto
+ * \param   src  the list whose nodes are to be moved, which must use the same pool as 'dst'
+ * \return  the return code for the concatenation operation
+ */
+s_l_list_rc_e s_l_list_concat(s_l_list_s *dst, s_l_list_s *src);
+
+/**
+ * \brief   Sort the elements of a circ. singly linked list in place, in ascending order, with a
+ *          stable bottom-up merge sort which only relinks the existing nodes, so it doesn't
+ *          (de)allocate any memory.
+ * \param   list          the list whose elements are to be sorted
+ * \param   elem_compare  pointer to a callback function used to compare two elements; it must
+ *                        return 0 if they're 'equal', > 0 if the second element is 'greater'
+ *                        than the first one, or < 0 otherwise
+ * \return  the return code for the sort operation
+ */
+s_l_list_rc_e s_l_list_sort(s_l_list_s *list, int (*elem_compare)(void *, void *));
+
 /**
  * \brief   Traverse all the list nodes from the beginning to the end, applying the 'elem_visit'
  *          callback function to all its elements.
@@ -83,6 +143,86 @@ s_l_list_rc_e s_l_list_insert_back(s_l_list_s *list, void *elem);
  */
 s_l_list_rc_e s_l_list_traverse(s_l_list_s *list, void (*elem_visit)(void *));
 
+/**
+ * \brief   Find the first element of a circ. singly linked list which is 'equal' to a given one.
+ * \param   list          the list whose element is to be found
+ * \param   elem          an 'example' element to be compared to every other in the list
+ * \param   elem_compare  pointer to a callback function used to compare the 'example' element
+ *                        to the others in the list; it must return 0 if the provided element
+ *                        is 'equal' to the element stored in the list, and non-zero otherwise
+ * \return  the element found, or null if there's none
+ */
+void *s_l_list_find(s_l_list_s *list, void *elem, int (*elem_compare)(void *, void *));
+
+/**
+ * \brief   Remove all the elements of a circ. singly linked list which match a predicate, in a
+ *          single pass, deallocating them (if an 'elem_destroy' callback function is provided).
+ * \param   list          the list whose elements are to be removed
+ * \param   elem_match    pointer to a callback function which tells whether an element is to be
+ *                        removed
+ * \param   elem_destroy  a pointer to a callback function which deallocates the removed elements
+ * \return  the return code for the remove operation
+ */
+s_l_list_rc_e s_l_list_remove_if(s_l_list_s *list, bool (*elem_match)(void *),
+                                 void (*elem_destroy)(void **));
+
+/**
+ * \brief   Point a cursor to the 'front' (beginning) of a circ. singly linked list, or to its
+ *          end if the list is empty.
+ * \param   cursor  the cursor to be pointed
+ * \param   list    the list the cursor is to iterate over
+ * \return  the return code for the operation
+ */
+s_l_list_rc_e s_l_list_cursor_begin(s_l_list_cursor_s *cursor, s_l_list_s *list);
+
+/**
+ * \brief   Point a cursor to the end of a circ. singly linked list (past its 'back' node).
+ * \param   cursor  the cursor to be pointed
+ * \param   list    the list the cursor is to iterate over
+ * \return  the return code for the operation
+ */
+s_l_list_rc_e s_l_list_cursor_end(s_l_list_cursor_s *cursor, s_l_list_s *list);
+
+/**
+ * \brief   Move a cursor to the next node of its list, or to the end if it's at the back node.
+ * \param   cursor  the cursor to be moved
+ * \return  the return code for the operation
+ */
+s_l_list_rc_e s_l_list_cursor_next(s_l_list_cursor_s *cursor);
+
+/**
+ * \brief   Get the element of the current node of a cursor.
+ * \param   cursor  the cursor whose element is to be gotten
+ * \return  the element, or null if the cursor is at the end of the list
+ */
+void *s_l_list_cursor_get(s_l_list_cursor_s *cursor);
+
+/**
+ * \brief   Remove the current node of a cursor from its list, moving the cursor to the next node.
+ * \param   cursor  the cursor whose current node is to be removed
+ * \return  the element removed from the list (or null if the cursor is at the end of the list);
+ *          it's the user's responsibility to deallocate it
+ */
+void *s_l_list_cursor_remove_current(s_l_list_cursor_s *cursor);
+
+/**
+ * \brief   Insert a non-null element before the current node of a cursor (or at the 'back' of the
+ *          list, if the cursor is at its end). The cursor stays at its current node.
+ * \param   cursor  the cursor the element is to be inserted before
+ * \param   elem    the element to be inserted onto the list
+ * \return  the return code for the insert operation
+ */
+s_l_list_rc_e s_l_list_cursor_insert_before(s_l_list_cursor_s *cursor, void *elem);
+
+/**
+ * \brief   Insert a non-null element after the current node of a cursor. The cursor stays at its
+ *          current node.
+ * \param   cursor  the cursor the element is to be inserted after
+ * \param   elem    the element to be inserted onto the list
+ * \return  the return code for the insert operation
+ */
+s_l_list_rc_e s_l_list_cursor_insert_after(s_l_list_cursor_s *cursor, void *elem);
+
 /**
  * \brief   Remove the element at the 'front' (beginning) of the circ. singly linked list.
  * \param   list  the list whose element is to be removed
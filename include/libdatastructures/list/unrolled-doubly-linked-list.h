@@ -0,0 +1,167 @@
+/**
+ * \file   unrolled-doubly-linked-list.h
+ * \brief  Circ. unrolled doubly linked list - struct. and type definitions and func. declarations
+ */
+#ifndef LIBDATASTRUCTURES_UNROLLED_DOUBLY_LINKED_LIST_H
+#define LIBDATASTRUCTURES_UNROLLED_DOUBLY_LINKED_LIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+/* ************************************************************************************************/
+
+/** No. of elements stored in every node, so a node fills two 64-byte cache lines */
+#define U_D_L_LIST_NODE_LENGTH 12
+
+/** Forward declaration of unrolled doubly linked list node structure */
+struct unrolled_doubly_linked_list_node;
+
+/** Unrolled doubly linked list node type */
+typedef struct unrolled_doubly_linked_list_node u_d_l_list_node_s;
+
+/** Unrolled doubly linked list node structure, which stores several elements as a small ring */
+struct unrolled_doubly_linked_list_node {
+    /** Pointer to the previous node in the list, or to itself if it's single */
+    u_d_l_list_node_s *prev;
+    /** Pointer to the next node in the list, or to itself if it's single */
+    u_d_l_list_node_s *next;
+    /** Slot of the ring where the first element of the node is stored */
+    size_t first;
+    /** No. of elements stored in the node */
+    size_t count;
+    /** The elements stored in the node */
+    void *elems[U_D_L_LIST_NODE_LENGTH];
+};
+
+/**
+ * Unrolled doubly linked list structure. Every node stores up to U_D_L_LIST_NODE_LENGTH elements,
+ * so the list takes about one word per element (instead of three, plus the allocation overhead of
+ * every node) and its traversal reads the elements mostly sequentially.
+ */
+struct unrolled_doubly_linked_list {
+    /** Pointer to the first node (the 'front' of the list) */
+    u_d_l_list_node_s *front;
+    /** No. of elements stored in the list */
+    size_t count;
+};
+
+/** Unrolled doubly linked list type */
+typedef struct unrolled_doubly_linked_list u_d_l_list_s;
+
+/** Unrolled doubly linked list operations return codes */
+enum unrolled_doubly_linked_list_rc {
+    /** No error */
+    U_D_L_LIST_RC_OK = 0,
+    /** List is null */
+    U_D_L_LIST_RC_NULL = -1,
+    /** List is empty (contains no elements) */
+    U_D_L_LIST_RC_EMPTY = -2,
+    /** The element to be inserted is null */
+    U_D_L_LIST_RC_ELEM_NULL = -3,
+    /** The callback function to operate on the element is null */
+    U_D_L_LIST_RC_ELEM_CB_NULL = -4,
+    /** The allocation of a new node has failed */
+    U_D_L_LIST_RC_NODE_ALLOC_ERR = -5,
+};
+
+/** Unrolled doubly linked list operation return code type */
+typedef enum unrolled_doubly_linked_list_rc u_d_l_list_rc_e;
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Initialize a circular unrolled doubly linked list.
+ * \param  list  pointer to the list to be initialized
+ */
+void u_d_l_list_init(u_d_l_list_s *list);
+
+/**
+ * \brief   Create and initialize a new circular unrolled doubly linked list.
+ * \return  a pointer to the allocated list
+ */
+u_d_l_list_s *u_d_l_list_new(void);
+
+/**
+ * \brief   Insert a non-null element to the 'front' (beginning) of a circ. unrolled doubly linked
+ *          list. A node is only allocated when the first node is full.
+ * \param   list  the list whose element is to be inserted onto
+ * \param   elem  the element to be inserted onto the list
+ * \return  the return code for the insert operation
+ */
+u_d_l_list_rc_e u_d_l_list_insert_front(u_d_l_list_s *list, void *elem);
+
+/**
+ * \brief   Insert a non-null element to the 'back' (end) of a circ. unrolled doubly linked list.
+ *          A node is only allocated when the last node is full.
+ * \param   list  the list whose element is to be inserted onto
+ * \param   elem  the element to be inserted onto the list
+ * \return  the return code for the insert operation
+ */
+u_d_l_list_rc_e u_d_l_list_insert_back(u_d_l_list_s *list, void *elem);
+
+/**
+ * \brief   Get the number of elements stored in the list.
+ * \param   list  the list whose number of elements is to be gotten
+ * \return  the number of elements stored in the list
+ */
+size_t u_d_l_list_count(u_d_l_list_s *list);
+
+/**
+ * \brief   Traverse all the list elements in a forward direction, from the beginning to the end,
+ *          applying the 'elem_visit' callback function to all its elements.
+ * \param   list        the list to be traversed by
+ * \param   elem_visit  pointer to a callback function which 'visits' all the elems. in the list
+ * \return  the return code for the traversal operation
+ */
+u_d_l_list_rc_e u_d_l_list_traverse_forward(u_d_l_list_s *list, void (*elem_visit)(void *));
+
+/**
+ * \brief   Traverse all the list elements in a backward direction, from the end to the beginning,
+ *          applying the 'elem_visit' callback function to all its elements.
+ * \param   list        the list to be traversed by
+ * \param   elem_visit  pointer to a callback function which 'visits' all the elems. in the list
+ * \return  the return code for the traversal operation
+ */
+u_d_l_list_rc_e u_d_l_list_traverse_backward(u_d_l_list_s *list, void (*elem_visit)(void *));
+
+/**
+ * \brief   Remove the element at the 'front' (beginning) of the circ. unrolled doubly linked list.
+ * \param   list  the list whose element is to be removed
+ * \return  the element removed from the list; it's the user's responsibility to deallocate it
+ */
+void *u_d_l_list_remove_front(u_d_l_list_s *list);
+
+/**
+ * \brief   Remove the element at the 'back' (end) of the circ. unrolled doubly linked list.
+ * \param   list  the list whose element is to be removed
+ * \return  the element removed from the list; it's the user's responsibility to deallocate it
+ */
+void *u_d_l_list_remove_back(u_d_l_list_s *list);
+
+/**
+ * \brief   Deallocate ('destroy') all the nodes in the list, including its elements (if an
+ *          'elem_destroy' callback function is provided), making the list empty.
+ * \param   list          the list whose nodes are to be 'destroyed'
+ * \param   elem_destroy  a pointer to a callback function which deallocates all the list elements
+ * \return  the return code for the deallocation operation
+ */
+u_d_l_list_rc_e u_d_l_list_clear(u_d_l_list_s *list, void (*elem_destroy)(void **));
+
+/**
+ * \brief   Deallocate ('destroy') all the nodes in the list and the list itself.
+ * \param   list          pointer to the list to be 'destroyed'
+ * \param   elem_destroy  a pointer to a callback function which deallocates all the list elements
+ * \return  the return code for the 'destroy' operation
+ */
+u_d_l_list_rc_e u_d_l_list_destroy(u_d_l_list_s **list, void (*elem_destroy)(void **));
+
+/* ************************************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LIBDATASTRUCTURES_UNROLLED_DOUBLY_LINKED_LIST_H */
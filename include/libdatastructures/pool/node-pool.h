@@ -0,0 +1,118 @@
+/**
+ * \file   node-pool.h
+ * \brief  Node pool (slab allocator) - struct. and type definitions and function declarations
+ */
+#ifndef LIBDATASTRUCTURES_NODE_POOL_H
+#define LIBDATASTRUCTURES_NODE_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+/* ************************************************************************************************/
+
+/**
+ * Node pool structure, which allocates fixed-size nodes out of larger blocks ('slabs') of memory
+ * and keeps the deallocated ones on a free list for reuse, instead of calling 'malloc' and 'free'
+ * for every node. The slabs are only deallocated when the pool is destroyed. A pool may be owned
+ * by a single data structure or shared by many of them, but it isn't thread-safe.
+ */
+struct node_pool {
+    /** Size (in bytes) of every node, rounded up so every node is aligned as a pointer */
+    size_t node_size;
+    /** No. of nodes of every slab */
+    size_t slab_length;
+    /** Pointer to the last allocated slab, which points to the previously allocated one */
+    void *slabs;
+    /** Pointer to the first free node, which points to the next free one */
+    void *free_nodes;
+    /** No. of nodes currently allocated out of the pool */
+    size_t count;
+    /** No. of nodes of all the slabs */
+    size_t capacity;
+};
+
+/** Node pool type */
+typedef struct node_pool node_pool_s;
+
+/** Node pool operations return codes */
+enum node_pool_rc {
+    /** No error */
+    NODE_POOL_RC_OK = 0,
+    /** Pool is null */
+    NODE_POOL_RC_NULL = -1,
+    /** The allocation of a new slab has failed */
+    NODE_POOL_RC_SLAB_ALLOC_ERR = -2
+};
+
+/** Node pool operation return code type */
+typedef enum node_pool_rc node_pool_rc_e;
+
+/** The no. of nodes of every slab when none is given */
+#define NODE_POOL_DEFAULT_SLAB_LENGTH 64
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Initialize a node pool, without allocating any slab yet.
+ * \param  pool         pointer to the pool to be initialized
+ * \param  node_size    the size (in bytes) of the nodes to be allocated out of the pool
+ * \param  slab_length  the no. of nodes of every slab (zero for NODE_POOL_DEFAULT_SLAB_LENGTH)
+ */
+void node_pool_init(node_pool_s *pool, size_t node_size, size_t slab_length);
+
+/**
+ * \brief   Create and initialize a new node pool.
+ * \param   node_size    the size (in bytes) of the nodes to be allocated out of the pool
+ * \param   slab_length  the no. of nodes of every slab (zero for NODE_POOL_DEFAULT_SLAB_LENGTH)
+ * \return  a pointer to the allocated pool
+ */
+node_pool_s *node_pool_new(size_t node_size, size_t slab_length);
+
+/**
+ * \brief   Make sure at least a given no. of nodes can be allocated out of the pool without
+ *          allocating any other slab.
+ * \param   pool   the pool whose slabs are to be allocated
+ * \param   nodes  the no. of nodes which must be available
+ * \return  the return code for the reserve operation
+ */
+node_pool_rc_e node_pool_reserve(node_pool_s *pool, size_t nodes);
+
+/**
+ * \brief   Allocate a node out of the pool, allocating a new slab only if there's no free node.
+ * \param   pool  the pool the node is to be allocated out of
+ * \return  pointer to the (uninitialized) node, or null if the allocation has failed
+ */
+void *node_pool_alloc(node_pool_s *pool);
+
+/**
+ * \brief  Give a node back to the pool, so it can be reused by a later allocation.
+ * \param  pool  the pool the node was allocated out of
+ * \param  node  pointer to the node to be given back (it may be null)
+ */
+void node_pool_free(node_pool_s *pool, void *node);
+
+/**
+ * \brief   Get the no. of nodes currently allocated out of the pool.
+ * \param   pool  the pool whose no. of allocated nodes is to be gotten
+ * \return  the no. of allocated nodes
+ */
+size_t node_pool_count(node_pool_s *pool);
+
+/**
+ * \brief   Deallocate ('destroy') all the slabs of the pool and the pool itself. All the data
+ *          structures which use the pool must have been cleared or destroyed before.
+ * \param   pool  pointer to the pool to be 'destroyed'
+ * \return  the return code for the 'destroy' operation
+ */
+node_pool_rc_e node_pool_destroy(node_pool_s **pool);
+
+/* ************************************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LIBDATASTRUCTURES_NODE_POOL_H */
@@ -0,0 +1,164 @@
+/**
+ * \file   blocking-queue.h
+ * \brief  Blocking bounded queue - struct. and type definitions and functions declarations
+ */
+#ifndef LIBDATASTRUCTURES_BLOCKING_QUEUE_H
+#define LIBDATASTRUCTURES_BLOCKING_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "libdatastructures/queue/queue.h"
+
+/* ************************************************************************************************/
+
+/** Timeout (in milliseconds) of an operation which waits for as long as needed */
+#define BLOCKING_QUEUE_WAIT_FOREVER (-1L)
+
+/**
+ * Blocking queue data structure, which is a queue guarded by a mutex, so it's safe to be used by
+ * many threads at once. A thread enqueueing an element into a full queue (if its capacity is
+ * limited) or dequeueing an element off an empty queue sleeps until there's room (or an element),
+ * or until a timeout expires, instead of polling the queue. The timeouts are measured against a
+ * monotonic clock, so changes to the system time don't affect them.
+ */
+struct blocking_queue {
+    /** The queue storing the elements */
+    queue_s queue;
+    /** The maximum number of elements in the queue (zero for no limit) */
+    size_t capacity;
+    /** Boolean indicating whether the queue has been closed (so no elements may be enqueued) */
+    bool closed;
+    /** The mutex guarding all the above */
+    pthread_mutex_t lock;
+    /** Condition variable signaled when an element is enqueued (or the queue is closed) */
+    pthread_cond_t not_empty;
+    /** Condition variable signaled when an element is dequeued (or the queue is closed) */
+    pthread_cond_t not_full;
+};
+
+/** Blocking queue data structure type */
+typedef struct blocking_queue blocking_queue_s;
+
+/** Blocking queue operations return codes */
+enum blocking_queue_rc {
+    /** No error */
+    BLOCKING_QUEUE_RC_OK = 0,
+    /** Queue is null */
+    BLOCKING_QUEUE_RC_NULL = -1,
+    /** Queue is empty (contains no elements) */
+    BLOCKING_QUEUE_RC_EMPTY = -2,
+    /** The element to be enqueued is null */
+    BLOCKING_QUEUE_RC_ELEM_NULL = -3,
+    /** The callback function to operate on the element is null */
+    BLOCKING_QUEUE_RC_ELEM_CB_NULL = -4,
+    /** The allocation of a new node has failed */
+    BLOCKING_QUEUE_RC_NODE_ALLOC_ERR = -5,
+    /** Queue is full (and the operation wasn't allowed to wait) */
+    BLOCKING_QUEUE_RC_FULL = -6,
+    /** The timeout of the operation has expired */
+    BLOCKING_QUEUE_RC_TIMEOUT = -7,
+    /** Queue has been closed */
+    BLOCKING_QUEUE_RC_CLOSED = -8
+};
+
+/** Blocking queue operation return code type */
+typedef enum blocking_queue_rc blocking_queue_rc_e;
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Initialize a blocking queue.
+ * \param  queue     pointer to the queue to be initialized
+ * \param  capacity  the maximum number of elements in the queue (zero for no limit)
+ */
+void blocking_queue_init(blocking_queue_s *queue, size_t capacity);
+
+/**
+ * \brief   Create and initialize a blocking queue.
+ * \param   capacity  the maximum number of elements in the queue (zero for no limit)
+ * \return  a pointer to the allocated queue
+ */
+blocking_queue_s *blocking_queue_new(size_t capacity);
+
+/**
+ * \brief   Enqueue an element into the queue, waiting for room if the queue is full.
+ * \param   queue       the queue where the element is to be enqueued
+ * \param   elem        the element to be enqueued
+ * \param   timeout_ms  the maximum time to wait for room, in milliseconds (zero not to wait at
+ *                      all, or 'BLOCKING_QUEUE_WAIT_FOREVER')
+ * \return  the return code for the operation ('full' if the queue is full and it wasn't allowed
+ *          to wait, 'timeout' if it's still full after waiting, 'closed' if it's been closed)
+ */
+blocking_queue_rc_e blocking_queue_enqueue(blocking_queue_s *queue, void *elem, long timeout_ms);
+
+/**
+ * \brief   Dequeue an element from the queue, waiting for one if the queue is empty.
+ * \param   queue       the queue whose element is to be dequeued from
+ * \param   timeout_ms  the maximum time to wait for an element, in milliseconds (zero not to wait
+ *                      at all, or 'BLOCKING_QUEUE_WAIT_FOREVER')
+ * \return  the element dequeued from the queue, or null if the queue is null, if it's still
+ *          empty after waiting or if it's been closed and emptied
+ */
+void *blocking_queue_dequeue(blocking_queue_s *queue, long timeout_ms);
+
+/**
+ * \brief   Dequeue many elements from the queue at once, in order and under a single acquisition
+ *          of its lock, waiting for at least one element if the queue is empty.
+ * \param   queue       the queue whose elements are to be dequeued from
+ * \param   elems       where the dequeued elements are to be stored, in order
+ * \param   max         the maximum number of elements to be dequeued
+ * \param   timeout_ms  the maximum time to wait for an element, in milliseconds (zero not to wait
+ *                      at all, or 'BLOCKING_QUEUE_WAIT_FOREVER')
+ * \return  the number of elements actually dequeued
+ */
+size_t blocking_queue_dequeue_batch(blocking_queue_s *queue, void **elems, size_t max,
+                                    long timeout_ms);
+
+/**
+ * \brief   Get the number of elements in the queue. While other threads are operating on the
+ *          queue, it may already be stale when returned.
+ * \param   queue  the queue whose number of elements is to be got
+ * \return  the number of elements in the queue
+ */
+size_t blocking_queue_count(blocking_queue_s *queue);
+
+/**
+ * \brief   Close the queue, so no more elements may be enqueued, waking up all the threads which
+ *          are waiting on it. The elements already in the queue may still be dequeued, and then
+ *          dequeueing off the queue doesn't wait anymore.
+ * \param   queue  the queue to be closed
+ * \return  the return code for the operation
+ */
+blocking_queue_rc_e blocking_queue_close(blocking_queue_s *queue);
+
+/**
+ * \brief   Deallocate ('destroy') all the nodes in the queue, including its elements (if an
+ *          'elem_destroy' callback function is provided), making the queue empty.
+ * \param   queue         the queue whose nodes are to be 'destroyed'
+ * \param   elem_destroy  a pointer to the callback func. which deallocates all the queue elems.
+ * \return  the return code for the deallocation operation
+ */
+blocking_queue_rc_e blocking_queue_clear(blocking_queue_s *queue, void (*elem_destroy)(void **));
+
+/**
+ * \brief   Deallocate ('destroy') all the nodes in the queue and the queue itself. No other
+ *          thread may be operating on (or waiting on) the queue meanwhile.
+ * \param   queue         pointer to the queue to be 'destroyed'
+ * \param   elem_destroy  a pointer to a callback function which deallocates all the queue elements
+ * \return  the return code for the 'destroy' operation
+ */
+blocking_queue_rc_e blocking_queue_destroy(blocking_queue_s **queue,
+                                           void (*elem_destroy)(void **));
+
+/* ************************************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LIBDATASTRUCTURES_BLOCKING_QUEUE_H */
@@ -0,0 +1,154 @@
+/**
+ * \file   mpmc-queue.h
+ * \brief  Lock-free bounded multi-producer/multi-consumer queue - struct. and type definitions and
+ *         functions declarations
+ */
+#ifndef LIBDATASTRUCTURES_MPMC_QUEUE_H
+#define LIBDATASTRUCTURES_MPMC_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+/* ************************************************************************************************/
+
+#ifndef MPMC_QUEUE_CACHE_LINE
+/** Assumed size of a cache line, so the producers and the consumers don't share one */
+#define MPMC_QUEUE_CACHE_LINE 64
+#endif
+
+/** Cell of the MPMC queue ring buffer */
+struct mpmc_queue_cell {
+    /** Sequence number, telling whether the cell is ready to be enqueued into or dequeued from */
+    atomic_size_t seq;
+    /** The element stored in the cell */
+    void *elem;
+};
+
+/** MPMC queue cell type */
+typedef struct mpmc_queue_cell mpmc_queue_cell_s;
+
+/**
+ * Lock-free bounded multi-producer/multi-consumer ("MPMC") queue: a ring buffer whose cells carry
+ * a sequence number each (D. Vyukov's design), so producers and consumers only contend on their
+ * own position with a single CAS per operation, and never on a lock. Unlike 'queue_s', it's safe
+ * to be used by many threads at once (except for its initialization, clearing and destruction).
+ */
+struct mpmc_queue {
+    /** The ring buffer of cells, whose length is a power of two */
+    mpmc_queue_cell_s *cells;
+    /** The length of the ring buffer minus one, so a position is mapped to a cell by masking it */
+    size_t mask;
+    /** Padding, so the position of the producers doesn't share a cache line with the above */
+    char pad0[MPMC_QUEUE_CACHE_LINE];
+    /** The position the next element is to be enqueued at */
+    atomic_size_t enqueue_pos;
+    /** Padding, so the positions of the producers and the consumers don't share a cache line */
+    char pad1[MPMC_QUEUE_CACHE_LINE];
+    /** The position the next element is to be dequeued from */
+    atomic_size_t dequeue_pos;
+    /** Padding, so the position of the consumers doesn't share a cache line with other data */
+    char pad2[MPMC_QUEUE_CACHE_LINE];
+};
+
+/** MPMC queue data structure type */
+typedef struct mpmc_queue mpmc_queue_s;
+
+/** MPMC queue operations return codes */
+enum mpmc_queue_rc {
+    /** No error */
+    MPMC_QUEUE_RC_OK = 0,
+    /** Queue is null */
+    MPMC_QUEUE_RC_NULL = -1,
+    /** Queue is empty (contains no elements) */
+    MPMC_QUEUE_RC_EMPTY = -2,
+    /** The element to be enqueued is null */
+    MPMC_QUEUE_RC_ELEM_NULL = -3,
+    /** The callback function to operate on the element is null */
+    MPMC_QUEUE_RC_ELEM_CB_NULL = -4,
+    /** Queue is full (or its ring buffer couldn't be allocated) */
+    MPMC_QUEUE_RC_FULL = -5
+};
+
+/** MPMC queue operation return code type */
+typedef enum mpmc_queue_rc mpmc_queue_rc_e;
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Initialize an MPMC queue, allocating its ring buffer. If the allocation fails (or the
+ *         capacity is too large to be allocated at all), the capacity of the queue is zero (so
+ *         it's always full).
+ * \param  queue     pointer to the queue to be initialized
+ * \param  capacity  the maximum number of elements in the queue, rounded up to a power of two
+ *                   (and to at least 2)
+ */
+void mpmc_queue_init(mpmc_queue_s *queue, size_t capacity);
+
+/**
+ * \brief   Create and initialize an MPMC queue.
+ * \param   capacity  the maximum number of elements in the queue, rounded up to a power of two
+ *                    (and to at least 2)
+ * \return  a pointer to the allocated queue
+ */
+mpmc_queue_s *mpmc_queue_new(size_t capacity);
+
+/**
+ * \brief   Insert ('enqueue') an element at the back of the queue, without blocking.
+ * \param   queue  the queue where the element is to be enqueued
+ * \param   elem   the element to be enqueued
+ * \return  the return code for the operation ('full' if there's no room for the element)
+ */
+mpmc_queue_rc_e mpmc_queue_enqueue(mpmc_queue_s *queue, void *elem);
+
+/**
+ * \brief   Try to remove ('dequeue') an element from the front of the queue, without blocking.
+ * \param   queue  the queue from where the element is to be dequeued
+ * \return  the element removed from the queue, or null if the queue is null or empty
+ */
+void *mpmc_queue_try_dequeue(mpmc_queue_s *queue);
+
+/**
+ * \brief   Get the number of elements in the queue. While other threads are operating on the
+ *          queue, it's only a snapshot, which may already be stale when returned.
+ * \param   queue  the queue whose number of elements is to be got
+ * \return  the number of elements in the queue
+ */
+size_t mpmc_queue_count(mpmc_queue_s *queue);
+
+/**
+ * \brief   Get the maximum number of elements in the queue.
+ * \param   queue  the queue whose capacity is to be got
+ * \return  the capacity of the queue
+ */
+size_t mpmc_queue_capacity(mpmc_queue_s *queue);
+
+/**
+ * \brief   Remove all the elements from the queue, deallocating them (if an 'elem_destroy'
+ *          callback function is provided). No other thread may operate on the queue meanwhile.
+ * \param   queue         the queue whose elements are to be removed
+ * \param   elem_destroy  the callback function to deallocate every element of the queue
+ * \return  the return code for the operation
+ */
+mpmc_queue_rc_e mpmc_queue_clear(mpmc_queue_s *queue, void (*elem_destroy)(void **));
+
+/**
+ * \brief   Deallocate ('destroy') all the elements in the queue (if an 'elem_destroy' callback
+ *          function is provided), its ring buffer and the queue itself. No other thread may
+ *          operate on the queue meanwhile.
+ * \param   queue         pointer to the queue to be destroyed
+ * \param   elem_destroy  the callback function to deallocate every element of the queue
+ * \return  the return code for the operation
+ */
+mpmc_queue_rc_e mpmc_queue_destroy(mpmc_queue_s **queue, void (*elem_destroy)(void **));
+
+/* ************************************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LIBDATASTRUCTURES_MPMC_QUEUE_H */
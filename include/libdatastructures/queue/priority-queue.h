@@ -0,0 +1,168 @@
+/**
+ * \file   priority-queue.h
+ * \brief  Priority queue (d-ary heap) data structure - struct. and type definitions and functions
+ *         declarations
+ */
+#ifndef LIBDATASTRUCTURES_PRIORITY_QUEUE_H
+#define LIBDATASTRUCTURES_PRIORITY_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include "libdatastructures/array/array.h"
+
+/* ************************************************************************************************/
+
+/**
+ * Priority queue data structure, which is a d-ary min-heap (binary, 4-ary, ...) stored
+ * contiguously in a growable array: the children of the element at index 'i' are the ones at
+ * indices 'd * i + 1' to 'd * i + d'. Pushing an element and popping the minimum one are
+ * O(log n), without allocating anything unless the array grows. A 4-ary heap is shallower than a
+ * binary one, so it moves elements fewer times per push, while its children fit in a cache line.
+ *
+ * Optionally, the queue tells the index of every element whenever it's moved (so the element may
+ * store it as a 'handle'), which allows the key of an element to be decreased in place.
+ */
+struct priority_queue {
+    /** The growable array storing the heap, whose front is always its first slot */
+    array_s array;
+    /** The number of children of every element of the heap ('d') */
+    size_t arity;
+    /** The callback function comparing two elements, the 'lesser' one being popped first */
+    int (*elem_compare)(void *, void *);
+    /** The callback function telling an element its index in the heap, or null */
+    void (*elem_index)(void *, size_t);
+};
+
+/** Priority queue data structure type */
+typedef struct priority_queue pq_s;
+
+/** Priority queue operations return codes */
+enum pq_rc {
+    /** No error */
+    PQ_RC_OK = 0,
+    /** Priority queue is null */
+    PQ_RC_NULL = -1,
+    /** Priority queue is empty (contains no elements) */
+    PQ_RC_EMPTY = -2,
+    /** The element to be pushed is null */
+    PQ_RC_ELEM_NULL = -3,
+    /** The callback function to operate on the element is null */
+    PQ_RC_ELEM_CB_NULL = -4,
+    /** The allocation of the heap storage has failed */
+    PQ_RC_NODE_ALLOC_ERR = -5,
+    /** The index is out of the bounds of the heap */
+    PQ_RC_OUT_OF_RANGE = -6
+};
+
+/** Priority queue operation return code type */
+typedef enum pq_rc pq_rc_e;
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Initialize a priority queue.
+ * \param  pq            pointer to the priority queue to be initialized
+ * \param  arity         the number of children of every element of the heap (2 for a binary heap,
+ *                       4 for a 4-ary one, ...), which is at least 2
+ * \param  elem_compare  pointer to a callback function used to compare two elements; it must
+ *                       return 0 if they're 'equal', > 0 if the second element is 'greater'
+ *                       than the first one, or < 0 otherwise
+ */
+void pq_init(pq_s *pq, size_t arity, int (*elem_compare)(void *, void *));
+
+/**
+ * \brief   Create and initialize a priority queue.
+ * \param   arity         the number of children of every element of the heap (2 for a binary
+ *                        heap, 4 for a 4-ary one, ...), which is at least 2
+ * \param   elem_compare  pointer to a callback function used to compare two elements
+ * \return  a pointer to the allocated priority queue
+ */
+pq_s *pq_new(size_t arity, int (*elem_compare)(void *, void *));
+
+/**
+ * \brief   Make the priority queue tell every element its index in the heap, whenever it's
+ *          moved (and at once, for the elements already in the queue), so the index may be
+ *          passed to 'pq_decrease_key'.
+ * \param   pq          the priority queue whose callback function is to be set
+ * \param   elem_index  pointer to a callback function which stores the index of an element (or
+ *                      null, so no index is told anymore)
+ * \return  the return code for the operation
+ */
+pq_rc_e pq_set_elem_index(pq_s *pq, void (*elem_index)(void *, size_t));
+
+/**
+ * \brief   Insert ('push') an element into the priority queue.
+ * \param   pq    the priority queue where the element is to be pushed
+ * \param   elem  the element to be pushed
+ * \return  the return code for the operation
+ */
+pq_rc_e pq_push(pq_s *pq, void *elem);
+
+/**
+ * \brief   Insert many elements into the priority queue at once, rebuilding the heap bottom-up in
+ *          linear time (instead of pushing them one by one, in O(n log n)).
+ * \param   pq     the priority queue where the elements are to be inserted
+ * \param   elems  the elements to be inserted (none of which may be null)
+ * \param   n      the number of elements to be inserted
+ * \return  the return code for the operation
+ */
+pq_rc_e pq_heapify(pq_s *pq, void **elems, size_t n);
+
+/**
+ * \brief   Get the number of elements in the priority queue.
+ * \param   pq  the priority queue whose number of elements is to be got
+ * \return  the number of elements in the priority queue
+ */
+size_t pq_count(pq_s *pq);
+
+/**
+ * \brief   Get ('peek') the minimum element of the priority queue without actually removing it.
+ * \param   pq  the priority queue whose minimum element is to be picked
+ * \return  the minimum element, or null if the priority queue is null or empty
+ */
+void *pq_peek(pq_s *pq);
+
+/**
+ * \brief   Remove ('pop') the minimum element of the priority queue.
+ * \param   pq  the priority queue whose minimum element is to be popped
+ * \return  the minimum element, or null if the priority queue is null or empty
+ */
+void *pq_pop_min(pq_s *pq);
+
+/**
+ * \brief   Restore the heap after the key of an element has been decreased in place, moving the
+ *          element up towards the root as needed (the new index is told to the element).
+ * \param   pq   the priority queue where the element is
+ * \param   idx  the index of the element, as told by the 'elem_index' callback function
+ * \return  the return code for the operation
+ */
+pq_rc_e pq_decrease_key(pq_s *pq, size_t idx);
+
+/**
+ * \brief   Deallocate ('destroy') all the elements of the priority queue (if an 'elem_destroy'
+ *          callback function is provided), making the priority queue empty.
+ * \param   pq            the priority queue whose elements are to be 'destroyed'
+ * \param   elem_destroy  a pointer to the callback func. which deallocates all the elements
+ * \return  the return code for the deallocation operation
+ */
+pq_rc_e pq_clear(pq_s *pq, void (*elem_destroy)(void **));
+
+/**
+ * \brief   Deallocate ('destroy') all the elements of the priority queue, its storage and the
+ *          priority queue itself.
+ * \param   pq            pointer to the priority queue to be 'destroyed'
+ * \param   elem_destroy  a pointer to a callback function which deallocates all the elements
+ * \return  the return code for the 'destroy' operation
+ */
+pq_rc_e pq_destroy(pq_s **pq, void (*elem_destroy)(void **));
+
+/* ************************************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LIBDATASTRUCTURES_PRIORITY_QUEUE_H */
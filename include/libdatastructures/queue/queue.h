@@ -9,6 +9,7 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stddef.h>
 #include "libdatastructures/list/singly-linked-list.h"
 
@@ -30,7 +31,11 @@ enum queue_rc {
     /** The callback function to operate on the element is null */
     QUEUE_RC_ELEM_CB_NULL = S_L_LIST_RC_ELEM_CB_NULL,
     /** The allocation of a new node has failed */
-    QUEUE_RC_NODE_ALLOC_ERR = S_L_LIST_RC_NODE_ALLOC_ERR
+    QUEUE_RC_NODE_ALLOC_ERR = S_L_LIST_RC_NODE_ALLOC_ERR,
+    /** The queue must be empty for the operation */
+    QUEUE_RC_NOT_EMPTY = S_L_LIST_RC_NOT_EMPTY,
+    /** The nodes of the pool are too small to store the queue nodes */
+    QUEUE_RC_INVALID_POOL = S_L_LIST_RC_INVALID_POOL
 };
 
 /** Queue operation return code type */
@@ -50,6 +55,16 @@ void queue_init(queue_s *queue);
  */
 queue_s *queue_new(void);
 
+/**
+ * \brief   Make a queue allocate its nodes out of a node pool, which may be shared by many
+ *          queues (or null, so they're allocated by 'malloc'). The pool must outlive the nodes of
+ *          the queue, and it's only allowed to be set while the queue is empty.
+ * \param   queue  the queue whose pool is to be set
+ * \param   pool   the pool, whose node size must be at least 'sizeof(s_l_list_node_s)'
+ * \return  the return code for the operation
+ */
+queue_rc_e queue_set_pool(queue_s *queue, node_pool_s *pool);
+
 /**
  * \brief   Enqueue an element onto the queue.
  * \param   queue  the queue whose element is to be enqueued
@@ -88,6 +103,28 @@ void *queue_pick(queue_s *queue);
  */
 void *queue_dequeue(queue_s *queue);
 
+/**
+ * \brief   Dequeue many elements from the queue at once, in order.
+ * \param   queue  the queue whose elements are to be dequeued from
+ * \param   elems  where the dequeued elements are to be stored, in order
+ * \param   max    the maximum number of elements to be dequeued
+ * \return  the number of elements actually dequeued
+ */
+size_t queue_dequeue_batch(queue_s *queue, void **elems, size_t max);
+
+/**
+ * \brief   Remove all the elements of the queue which match a predicate, in a single pass and
+ *          keeping the others in order, deallocating them (if an 'elem_destroy' callback function
+ *          is provided).
+ * \param   queue         the queue whose elements are to be removed
+ * \param   elem_match    pointer to a callback function which tells whether an element is to be
+ *                        removed
+ * \param   elem_destroy  a pointer to the callback func. which deallocates the removed elements
+ * \return  the return code for the remove operation
+ */
+queue_rc_e queue_remove_if(queue_s *queue, bool (*elem_match)(void *),
+                           void (*elem_destroy)(void **));
+
 /**
  * \brief   Deallocate ('destroy') all the nodes in the queue, including its elements (if an
  *          'elem_destroy' callback function is provided), making the queue empty.
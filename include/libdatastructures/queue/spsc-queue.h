@@ -0,0 +1,177 @@
+/**
+ * \file   spsc-queue.h
+ * \brief  Wait-free bounded single-producer/single-consumer queue - struct. and type definitions
+ *         and functions declarations
+ */
+#ifndef LIBDATASTRUCTURES_SPSC_QUEUE_H
+#define LIBDATASTRUCTURES_SPSC_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+/* ************************************************************************************************/
+
+#ifndef SPSC_QUEUE_CACHE_LINE
+/** Assumed size of a cache line, so the producer and the consumer don't share one */
+#define SPSC_QUEUE_CACHE_LINE 64
+#endif
+
+/**
+ * Wait-free bounded single-producer/single-consumer ("SPSC") queue: a ring buffer which exactly
+ * one producer thread enqueues elements into while exactly one consumer thread dequeues elements
+ * from. Both indices only ever grow (they're masked to get a position in the ring buffer), and
+ * every thread keeps a cached copy of the other thread's index, so the cache line of the latter is
+ * only read when the queue looks full (or empty) according to the copy.
+ */
+struct spsc_queue {
+    /** The ring buffer of elements, whose length is a power of two */
+    void **elems;
+    /** The length of the ring buffer minus one, so an index is mapped to a position by masking */
+    size_t mask;
+    /** Padding, so the producer data doesn't share a cache line with the above */
+    char pad0[SPSC_QUEUE_CACHE_LINE];
+    /** The index the next element is to be enqueued at (written by the producer only) */
+    atomic_size_t tail;
+    /** The producer's cached copy of 'head' */
+    size_t head_cache;
+    /** Padding, so the producer and the consumer data don't share a cache line */
+    char pad1[SPSC_QUEUE_CACHE_LINE];
+    /** The index the next element is to be dequeued from (written by the consumer only) */
+    atomic_size_t head;
+    /** The consumer's cached copy of 'tail' */
+    size_t tail_cache;
+    /** Padding, so the consumer data doesn't share a cache line with other data */
+    char pad2[SPSC_QUEUE_CACHE_LINE];
+};
+
+/** SPSC queue data structure type */
+typedef struct spsc_queue spsc_queue_s;
+
+/** SPSC queue operations return codes */
+enum spsc_queue_rc {
+    /** No error */
+    SPSC_QUEUE_RC_OK = 0,
+    /** Queue is null */
+    SPSC_QUEUE_RC_NULL = -1,
+    /** Queue is empty (contains no elements) */
+    SPSC_QUEUE_RC_EMPTY = -2,
+    /** The element to be enqueued is null */
+    SPSC_QUEUE_RC_ELEM_NULL = -3,
+    /** The callback function to operate on the element is null */
+    SPSC_QUEUE_RC_ELEM_CB_NULL = -4,
+    /** Queue is full (or its ring buffer couldn't be allocated) */
+    SPSC_QUEUE_RC_FULL = -5
+};
+
+/** SPSC queue operation return code type */
+typedef enum spsc_queue_rc spsc_queue_rc_e;
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Initialize an SPSC queue, allocating its ring buffer. If the allocation fails (or the
+ *         capacity is too large to be allocated at all), the capacity of the queue is zero (so
+ *         it's always full).
+ * \param  queue     pointer to the queue to be initialized
+ * \param  capacity  the maximum number of elements in the queue, rounded up to a power of two
+ */
+void spsc_queue_init(spsc_queue_s *queue, size_t capacity);
+
+/**
+ * \brief   Create and initialize an SPSC queue.
+ * \param   capacity  the maximum number of elements in the queue, rounded up to a power of two
+ * \return  a pointer to the allocated queue
+ */
+spsc_queue_s *spsc_queue_new(size_t capacity);
+
+/**
+ * \brief   Insert ('enqueue') an element at the back of the queue. It may only be called by the
+ *          producer thread.
+ * \param   queue  the queue where the element is to be enqueued
+ * \param   elem   the element to be enqueued
+ * \return  the return code for the operation ('full' if there's no room for the element)
+ */
+spsc_queue_rc_e spsc_queue_enqueue(spsc_queue_s *queue, void *elem);
+
+/**
+ * \brief   Insert ('enqueue') many elements at the back of the queue at once, publishing them to
+ *          the consumer together. It stops at the first null element or when the queue gets full.
+ *          It may only be called by the producer thread.
+ * \param   queue  the queue where the elements are to be enqueued
+ * \param   elems  the elements to be enqueued, in order
+ * \param   n      the number of elements to be enqueued
+ * \return  the number of elements actually enqueued (from the first one on)
+ */
+size_t spsc_queue_enqueue_batch(spsc_queue_s *queue, void **elems, size_t n);
+
+/**
+ * \brief   Get the number of elements in the queue. While the other thread is operating on the
+ *          queue, it's only a snapshot, which may already be stale when returned.
+ * \param   queue  the queue whose number of elements is to be got
+ * \return  the number of elements in the queue
+ */
+size_t spsc_queue_count(spsc_queue_s *queue);
+
+/**
+ * \brief   Get the maximum number of elements in the queue.
+ * \param   queue  the queue whose capacity is to be got
+ * \return  the capacity of the queue
+ */
+size_t spsc_queue_capacity(spsc_queue_s *queue);
+
+/**
+ * \brief   Get ('pick') the element from the front of the queue without actually removing it. It
+ *          may only be called by the consumer thread.
+ * \param   queue  the queue whose element is to be picked from its front
+ * \return  the element picked from the front of the queue, or null if the queue is empty
+ */
+void *spsc_queue_pick(spsc_queue_s *queue);
+
+/**
+ * \brief   Remove ('dequeue') an element from the front of the queue. It may only be called by
+ *          the consumer thread.
+ * \param   queue  the queue from where the element is to be dequeued
+ * \return  the element removed from the queue, or null if the queue is null or empty
+ */
+void *spsc_queue_dequeue(spsc_queue_s *queue);
+
+/**
+ * \brief   Remove ('dequeue') many elements from the front of the queue at once, handing their
+ *          cells back to the producer together. It may only be called by the consumer thread.
+ * \param   queue  the queue from where the elements are to be dequeued
+ * \param   elems  where the dequeued elements are to be stored, in order
+ * \param   n      the maximum number of elements to be dequeued
+ * \return  the number of elements actually dequeued
+ */
+size_t spsc_queue_dequeue_batch(spsc_queue_s *queue, void **elems, size_t n);
+
+/**
+ * \brief   Remove all the elements from the queue, deallocating them (if an 'elem_destroy'
+ *          callback function is provided). No other thread may operate on the queue meanwhile.
+ * \param   queue         the queue whose elements are to be removed
+ * \param   elem_destroy  the callback function to deallocate every element of the queue
+ * \return  the return code for the operation
+ */
+spsc_queue_rc_e spsc_queue_clear(spsc_queue_s *queue, void (*elem_destroy)(void **));
+
+/**
+ * \brief   Deallocate ('destroy') all the elements in the queue (if an 'elem_destroy' callback
+ *          function is provided), its ring buffer and the queue itself. No other thread may
+ *          operate on the queue meanwhile.
+ * \param   queue         pointer to the queue to be destroyed
+ * \param   elem_destroy  the callback function to deallocate every element of the queue
+ * \return  the return code for the operation
+ */
+spsc_queue_rc_e spsc_queue_destroy(spsc_queue_s **queue, void (*elem_destroy)(void **));
+
+/* ************************************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LIBDATASTRUCTURES_SPSC_QUEUE_H */
@@ -0,0 +1,169 @@
+/**
+ * \file   concurrent-stack.h
+ * \brief  Lock-free bounded stack (Treiber stack) - struct. and type definitions and functions
+ *         declarations
+ */
+#ifndef LIBDATASTRUCTURES_CONCURRENT_STACK_H
+#define LIBDATASTRUCTURES_CONCURRENT_STACK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* ************************************************************************************************/
+
+#ifndef CONCURRENT_STACK_CACHE_LINE
+/** Assumed size of a cache line, so the heads of the stack lists don't share one */
+#define CONCURRENT_STACK_CACHE_LINE 64
+#endif
+
+/** Node of the concurrent stack, which is linked to the next one by its index */
+struct concurrent_stack_node {
+    /** The element stored in the node */
+    void *elem;
+    /** Index of the next node in the list the node is in */
+    atomic_uint_least32_t next;
+};
+
+/** Concurrent stack node type */
+typedef struct concurrent_stack_node concurrent_stack_node_s;
+
+/**
+ * Lock-free bounded stack (R. K. Treiber's design), which is safe to be pushed onto and popped
+ * from by many threads at once. Its nodes are allocated all at once, up front, and linked by their
+ * indices into either the stack itself or a list of free nodes, so a node is never deallocated
+ * while another thread may be reading it (it's only recycled). The head of every list is a
+ * 'tagged' index, whose tag is incremented on every change to the head, so a compare-and-swap
+ * never succeeds on a head which has been popped and pushed back meanwhile (the 'ABA' problem).
+ *
+ * Optionally, the threads failing a compare-and-swap on the stack head (i.e. under contention)
+ * meet at a random slot of an 'elimination' array, where a push and a pop cancel each other out
+ * (the element is handed from the pushing thread to the popping one) without touching the head.
+ */
+struct concurrent_stack {
+    /** The nodes of the stack */
+    concurrent_stack_node_s *nodes;
+    /** The total number of nodes */
+    uint32_t capacity;
+    /** The slots of the elimination array, or null if there's none */
+    atomic_uintptr_t *slots;
+    /** The number of slots of the elimination array */
+    size_t nslots;
+    /** Padding, so the stack head doesn't share a cache line with the above */
+    char pad0[CONCURRENT_STACK_CACHE_LINE];
+    /** The tagged index of the top node of the stack (the tag is in the upper 32 bits) */
+    atomic_uint_least64_t top;
+    /** Padding, so the heads of the stack and the free nodes list don't share a cache line */
+    char pad1[CONCURRENT_STACK_CACHE_LINE];
+    /** The tagged index of the first node of the free nodes list */
+    atomic_uint_least64_t free;
+    /** The number of elements in the stack */
+    atomic_size_t count;
+    /** Padding, so the free nodes list head doesn't share a cache line with other data */
+    char pad2[CONCURRENT_STACK_CACHE_LINE];
+};
+
+/** Concurrent stack data structure type */
+typedef struct concurrent_stack concurrent_stack_s;
+
+/** Concurrent stack operations return codes */
+enum concurrent_stack_rc {
+    /** No error */
+    CONCURRENT_STACK_RC_OK = 0,
+    /** Stack is null */
+    CONCURRENT_STACK_RC_NULL = -1,
+    /** Stack is empty (contains no elements) */
+    CONCURRENT_STACK_RC_EMPTY = -2,
+    /** The element to be pushed is null */
+    CONCURRENT_STACK_RC_ELEM_NULL = -3,
+    /** The callback function to operate on the element is null */
+    CONCURRENT_STACK_RC_ELEM_CB_NULL = -4,
+    /** Stack is full (or its nodes couldn't be allocated) */
+    CONCURRENT_STACK_RC_FULL = -5
+};
+
+/** Concurrent stack operation return code type */
+typedef enum concurrent_stack_rc concurrent_stack_rc_e;
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Initialize a concurrent stack, allocating its nodes and its elimination array. If the
+ *         allocation of the nodes fails (or there'd be 2^32 or more), the capacity of the stack
+ *         is zero (so it's always full); if the elimination array's fails, there's none.
+ * \param  stack     pointer to the stack to be initialized
+ * \param  capacity  the maximum number of elements in the stack
+ * \param  nslots    the number of slots of the elimination array (zero for no elimination)
+ */
+void concurrent_stack_init(concurrent_stack_s *stack, size_t capacity, size_t nslots);
+
+/**
+ * \brief   Create and initialize a concurrent stack.
+ * \param   capacity  the maximum number of elements in the stack
+ * \param   nslots    the number of slots of the elimination array (zero for no elimination)
+ * \return  a pointer to the allocated stack
+ */
+concurrent_stack_s *concurrent_stack_new(size_t capacity, size_t nslots);
+
+/**
+ * \brief   Insert ('push') an element on the top of the stack.
+ * \param   stack  the stack where the element is to be pushed
+ * \param   elem   the element to be pushed
+ * \return  the return code for the operation ('full' if there's no free node for the element)
+ */
+concurrent_stack_rc_e concurrent_stack_push(concurrent_stack_s *stack, void *elem);
+
+/**
+ * \brief   Remove ('pop') the element from the top of the stack.
+ * \param   stack  the stack from where the element is to be popped
+ * \return  the element removed from the stack, or null if the stack is null or empty
+ */
+void *concurrent_stack_pop(concurrent_stack_s *stack);
+
+/**
+ * \brief   Get the number of elements in the stack. While other threads are operating on the
+ *          stack, it's only a snapshot, which may already be stale when returned.
+ * \param   stack  the stack whose number of elements is to be got
+ * \return  the number of elements in the stack
+ */
+size_t concurrent_stack_count(concurrent_stack_s *stack);
+
+/**
+ * \brief   Get the maximum number of elements in the stack.
+ * \param   stack  the stack whose capacity is to be got
+ * \return  the capacity of the stack
+ */
+size_t concurrent_stack_capacity(concurrent_stack_s *stack);
+
+/**
+ * \brief   Remove all the elements from the stack, deallocating them (if an 'elem_destroy'
+ *          callback function is provided). No other thread may operate on the stack meanwhile.
+ * \param   stack         the stack whose elements are to be removed
+ * \param   elem_destroy  the callback function to deallocate every element of the stack
+ * \return  the return code for the operation
+ */
+concurrent_stack_rc_e concurrent_stack_clear(concurrent_stack_s *stack,
+                                             void (*elem_destroy)(void **));
+
+/**
+ * \brief   Deallocate ('destroy') all the elements in the stack (if an 'elem_destroy' callback
+ *          function is provided), its nodes and the stack itself. No other thread may operate on
+ *          the stack meanwhile.
+ * \param   stack         pointer to the stack to be destroyed
+ * \param   elem_destroy  the callback function to deallocate every element of the stack
+ * \return  the return code for the operation
+ */
+concurrent_stack_rc_e concurrent_stack_destroy(concurrent_stack_s **stack,
+                                               void (*elem_destroy)(void **));
+
+/* ************************************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LIBDATASTRUCTURES_CONCURRENT_STACK_H */
@@ -9,13 +9,30 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stddef.h>
+#include "libdatastructures/array/array.h"
 #include "libdatastructures/list/singly-linked-list.h"
 
 /* ************************************************************************************************/
 
-/** Stack data structure type, which is actually a "wrapper" of a circ. singly linked list */
-typedef s_l_list_s stack_s;
+/**
+ * Stack data structure, which is actually a "wrapper" of either a circ. singly linked list (one
+ * node per element, with its top at the front of the list) or a contiguous, growable array (with
+ * its top at the back of the array, so pushing and popping elements is amortized constant time
+ * and only calls the allocator when the array grows).
+ */
+struct stack {
+    /** The list storing the elements, if the stack isn't contiguous */
+    s_l_list_s list;
+    /** The growable array storing the elements, if the stack is contiguous */
+    array_s array;
+    /** Boolean indicating whether the elements are stored in the array instead of the list */
+    bool contiguous;
+};
+
+/** Stack data structure type */
+typedef struct stack stack_s;
 
 /** Stack operations return codes */
 enum stack_rc {
@@ -29,8 +46,12 @@ enum stack_rc {
     STACK_RC_ELEM_NULL = S_L_LIST_RC_ELEM_NULL,
     /** The callback function to operate on the element is null */
     STACK_RC_ELEM_CB_NULL = S_L_LIST_RC_ELEM_CB_NULL,
-    /** The allocation of a new node has failed */
-    STACK_RC_NODE_ALLOC_ERR = S_L_LIST_RC_NODE_ALLOC_ERR
+    /** The allocation of a new node (or of a larger array, for a contiguous stack) has failed */
+    STACK_RC_NODE_ALLOC_ERR = S_L_LIST_RC_NODE_ALLOC_ERR,
+    /** The stack must be empty for the operation */
+    STACK_RC_NOT_EMPTY = S_L_LIST_RC_NOT_EMPTY,
+    /** The nodes of the pool are too small to store the stack nodes, or the stack is contiguous */
+    STACK_RC_INVALID_POOL = S_L_LIST_RC_INVALID_POOL
 };
 
 /** Stack operation return code type */
@@ -50,6 +71,32 @@ void stack_init(stack_s *stack);
  */
 stack_s *stack_new(void);
 
+/**
+ * \brief  Initialize a contiguous stack, whose elements are stored in a growable array.
+ * \param  stack     pointer to the stack to be initialized
+ * \param  capacity  the initial capacity of the array (the number of elements it can store before
+ *                   it has to grow)
+ */
+void stack_init_contiguous(stack_s *stack, size_t capacity);
+
+/**
+ * \brief   Create and initialize a contiguous stack, whose elements are stored in a growable array.
+ * \param   capacity  the initial capacity of the array
+ * \return  a pointer to the allocated stack
+ */
+stack_s *stack_new_contiguous(size_t capacity);
+
+/**
+ * \brief   Make a stack allocate its nodes out of a node pool, which may be shared by many
+ *          stacks (or null, so they're allocated by 'malloc'). The pool must outlive the nodes of
+ *          the stack, and it's only allowed to be set while the stack is empty. A contiguous
+ *          stack has no nodes, so it only accepts a null pool.
+ * \param   stack  the stack whose pool is to be set
+ * \param   pool   the pool, whose node size must be at least 'sizeof(s_l_list_node_s)'
+ * \return  the return code for the operation
+ */
+stack_rc_e stack_set_pool(stack_s *stack, node_pool_s *pool);
+
 /**
  * \brief   Push an element onto the stack.
  * \param   stack  the stack whose element is to be pushed onto
@@ -0,0 +1,536 @@
+/**
+ * \file   array-tiered.c
+ * \brief  Tiered (chunked) array - functions definitions
+ */
+
+#include <stdlib.h>
+#include "libdatastructures/array/array-tiered.h"
+
+/** Base 2 logarithm of the length of the chunks of an empty or small tiered array */
+#define ARRAY_TIERED_MIN_CHUNK_SHIFT 4
+
+/** The length a directory of chunks gets when it first grows from an empty one */
+#define ARRAY_TIERED_MIN_DIR_LENGTH 4
+
+/** Chunk of a tiered array, a fixed-length ring of elements */
+struct array_tiered_chunk {
+    /** Slot of the ring where the first element of the chunk is stored */
+    size_t front;
+    /** No. of elements stored on the chunk */
+    size_t count;
+    /** The elements of the chunk, stored as a ring */
+    void *elems[];
+};
+
+/** Chunk type */
+typedef struct array_tiered_chunk chunk_s;
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Get the length of every chunk of the tiered array.
+ * \param   a  the array whose chunk length is to be gotten
+ * \return  the length of the chunks
+ */
+static size_t array_tiered_chunk_length(array_tiered_s *a)
+{
+    return (size_t)1 << a->chunk_shift;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Get the slot of the ring of a chunk where an element of the chunk is stored.
+ * \param   a    the array whose chunk is to be indexed
+ * \param   c    the chunk to be indexed
+ * \param   off  the position of the element in the chunk (it may be one past the last one)
+ * \return  the slot of the ring
+ */
+static size_t array_tiered_slot(array_tiered_s *a, chunk_s *c, size_t off)
+{
+    return (c->front + off) & (array_tiered_chunk_length(a) - 1);
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Allocate a new, empty chunk for the tiered array.
+ * \param   a  the array the chunk is to be allocated for
+ * \return  pointer to the allocated chunk, or null if the allocation has failed
+ */
+static chunk_s *array_tiered_chunk_new(array_tiered_s *a)
+{
+    chunk_s *c = (chunk_s *)malloc(sizeof(chunk_s) + array_tiered_chunk_length(a) * sizeof(void *));
+
+    if (NULL != c) {
+        c->front = 0;
+        c->count = 0;
+    }
+
+    return c;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Push an element onto the front of a chunk which is not full.
+ * \param  a     the array whose chunk is to be pushed onto
+ * \param  c     the chunk
+ * \param  elem  the element to be pushed
+ */
+static void array_tiered_chunk_push_front(array_tiered_s *a, chunk_s *c, void *elem)
+{
+    c->front = (c->front - 1) & (array_tiered_chunk_length(a) - 1);
+    c->elems[c->front] = elem;
+    c->count++;
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Push an element onto the back of a chunk which is not full.
+ * \param  a     the array whose chunk is to be pushed onto
+ * \param  c     the chunk
+ * \param  elem  the element to be pushed
+ */
+static void array_tiered_chunk_push_back(array_tiered_s *a, chunk_s *c, void *elem)
+{
+    c->elems[array_tiered_slot(a, c, c->count)] = elem;
+    c->count++;
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Pop the element from the front of a non-empty chunk.
+ * \param   a  the array whose chunk is to be popped from
+ * \param   c  the chunk
+ * \return  the popped element
+ */
+static void *array_tiered_chunk_pop_front(array_tiered_s *a, chunk_s *c)
+{
+    void *elem = c->elems[c->front];
+
+    c->front = array_tiered_slot(a, c, 1);
+    c->count--;
+
+    return elem;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Pop the element from the back of a non-empty chunk.
+ * \param   a  the array whose chunk is to be popped from
+ * \param   c  the chunk
+ * \return  the popped element
+ */
+static void *array_tiered_chunk_pop_back(array_tiered_s *a, chunk_s *c)
+{
+    c->count--;
+
+    return c->elems[array_tiered_slot(a, c, c->count)];
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Insert an element onto a position of a chunk which is not full, shifting the elements
+ *         on the shorter side of the position.
+ * \param  a     the array whose chunk is to be inserted onto
+ * \param  c     the chunk
+ * \param  off   the position in the chunk where the element is to be inserted
+ * \param  elem  the element to be inserted
+ */
+static void array_tiered_chunk_insert(array_tiered_s *a, chunk_s *c, size_t off, void *elem)
+{
+    if (off < c->count - off) {
+        c->front = (c->front - 1) & (array_tiered_chunk_length(a) - 1);
+
+        for (size_t i = 0; i < off; i++)
+            c->elems[array_tiered_slot(a, c, i)] = c->elems[array_tiered_slot(a, c, i + 1)];
+    } else {
+        for (size_t i = c->count; i > off; i--)
+            c->elems[array_tiered_slot(a, c, i)] = c->elems[array_tiered_slot(a, c, i - 1)];
+    }
+
+    c->elems[array_tiered_slot(a, c, off)] = elem;
+    c->count++;
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Remove the element from a position of a chunk, shifting the elements on the shorter
+ *          side of the position.
+ * \param   a    the array whose chunk is to be removed from
+ * \param   c    the chunk
+ * \param   off  the position in the chunk where the element is to be removed
+ * \return  the removed element
+ */
+static void *array_tiered_chunk_erase(array_tiered_s *a, chunk_s *c, size_t off)
+{
+    void *elem = c->elems[array_tiered_slot(a, c, off)];
+
+    if (off < c->count - 1 - off) {
+        for (size_t i = off; i > 0; i--)
+            c->elems[array_tiered_slot(a, c, i)] = c->elems[array_tiered_slot(a, c, i - 1)];
+
+        c->front = array_tiered_slot(a, c, 1);
+    } else {
+        for (size_t i = off; i < c->count - 1; i++)
+            c->elems[array_tiered_slot(a, c, i)] = c->elems[array_tiered_slot(a, c, i + 1)];
+    }
+
+    c->count--;
+
+    return elem;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Move all the elements of the tiered array onto new chunks of a different length.
+ * \param   a            the array whose elements are to be moved
+ * \param   chunk_shift  base 2 logarithm of the length of the new chunks
+ * \return  the return code for the move; the array is left untouched if it's not 'OK'
+ */
+static array_rc_e array_tiered_rechunk(array_tiered_s *a, size_t chunk_shift)
+{
+    array_tiered_s b = { chunk_shift, NULL, 0, 0, a->count };
+    size_t length = array_tiered_chunk_length(&b);
+
+    b.dir_length = (a->count + length - 1) / length;
+
+    if (b.dir_length > 0) {
+        b.chunks = (chunk_s **)calloc(b.dir_length, sizeof(chunk_s *));
+
+        if (NULL == b.chunks)
+            return ARRAY_RC_NODE_ALLOC_ERR;
+    }
+
+    for (; b.nchunks < b.dir_length; b.nchunks++) {
+        b.chunks[b.nchunks] = array_tiered_chunk_new(&b);
+
+        if (NULL == b.chunks[b.nchunks]) {
+            while (b.nchunks > 0)
+                free(b.chunks[--b.nchunks]);
+
+            free(b.chunks);
+
+            return ARRAY_RC_NODE_ALLOC_ERR;
+        }
+    }
+
+    /* Copy the elements in order, each old chunk onto one or more new ones (or vice versa) */
+    size_t dst = 0;
+
+    for (size_t i = 0; i < a->nchunks; i++) {
+        chunk_s *c = a->chunks[i];
+
+        for (size_t j = 0; j < c->count; j++) {
+            if (b.chunks[dst]->count == length)
+                dst++;
+
+            array_tiered_chunk_push_back(&b, b.chunks[dst], c->elems[array_tiered_slot(a, c, j)]);
+        }
+
+        free(c);
+    }
+
+    free(a->chunks);
+    *a = b;
+
+    return ARRAY_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Make sure the tiered array has room for one more element, lengthening its chunks when
+ *          there are as many chunks as elements in a chunk, or adding a chunk to its back.
+ * \param   a  the array which is to get room for one more element
+ * \return  the return code for the operation
+ */
+static array_rc_e array_tiered_make_room(array_tiered_s *a)
+{
+    if (a->count < (a->nchunks << a->chunk_shift))
+        return ARRAY_RC_OK;
+
+    /* If the chunks can't be lengthened, it's fine to add one more chunk of the same length */
+    if (a->nchunks >= array_tiered_chunk_length(a))
+        array_tiered_rechunk(a, a->chunk_shift + 1);
+
+    if (a->count < (a->nchunks << a->chunk_shift))
+        return ARRAY_RC_OK;
+
+    if (a->nchunks == a->dir_length) {
+        size_t length = (a->dir_length < ARRAY_TIERED_MIN_DIR_LENGTH ? ARRAY_TIERED_MIN_DIR_LENGTH
+                                                                      : a->dir_length * 2);
+        chunk_s **chunks = (chunk_s **)realloc(a->chunks, length * sizeof(chunk_s *));
+
+        if (NULL == chunks)
+            return ARRAY_RC_NODE_ALLOC_ERR;
+
+        a->chunks = chunks;
+        a->dir_length = length;
+    }
+
+    chunk_s *c = array_tiered_chunk_new(a);
+
+    if (NULL == c)
+        return ARRAY_RC_NODE_ALLOC_ERR;
+
+    a->chunks[a->nchunks++] = c;
+
+    return ARRAY_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+void array_init_tiered(array_tiered_s *a)
+{
+    if (NULL != a) {
+        a->chunk_shift = ARRAY_TIERED_MIN_CHUNK_SHIFT;
+        a->chunks = NULL;
+        a->nchunks = 0;
+        a->dir_length = 0;
+        a->count = 0;
+    }
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+array_tiered_s *array_new_tiered(void)
+{
+    array_tiered_s *a = (array_tiered_s *)malloc(sizeof(array_tiered_s));
+
+    array_init_tiered(a);
+
+    return a;
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_tiered_push_back(array_tiered_s *a, void *elem)
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    return array_tiered_push_at(a, elem, a->count);
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_tiered_push_front(array_tiered_s *a, void *elem)
+{
+    return array_tiered_push_at(a, elem, 0);
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_tiered_push_at(array_tiered_s *a, void *elem, size_t pos)
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    if (pos > a->count)
+        return ARRAY_RC_INVALID_POS;
+
+    array_rc_e rc = array_tiered_make_room(a);
+
+    if (ARRAY_RC_OK != rc)
+        return rc;
+
+    size_t i = pos >> a->chunk_shift;
+
+    /* Rotate the last element of every chunk after the position's one onto the next chunk */
+    for (size_t j = a->nchunks - 1; j > i; j--) {
+        void *last = array_tiered_chunk_pop_back(a, a->chunks[j - 1]);
+        array_tiered_chunk_push_front(a, a->chunks[j], last);
+    }
+
+    array_tiered_chunk_insert(a, a->chunks[i], pos & (array_tiered_chunk_length(a) - 1), elem);
+    a->count++;
+
+    return ARRAY_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+size_t array_tiered_count(array_tiered_s *a)
+{
+    if (NULL == a)
+        return 0;
+
+    return a->count;
+}
+
+/* ************************************************************************************************/
+
+void *array_tiered_pick_back(array_tiered_s *a)
+{
+    if (NULL == a || a->count < 1)
+        return NULL;
+
+    return array_tiered_pick_at(a, a->count - 1);
+}
+
+/* ************************************************************************************************/
+
+void *array_tiered_pick_front(array_tiered_s *a)
+{
+    return array_tiered_pick_at(a, 0);
+}
+
+/* ************************************************************************************************/
+
+void *array_tiered_pick_at(array_tiered_s *a, size_t pos)
+{
+    if (NULL == a || pos >= a->count)
+        return NULL;
+
+    chunk_s *c = a->chunks[pos >> a->chunk_shift];
+
+    return c->elems[array_tiered_slot(a, c, pos & (array_tiered_chunk_length(a) - 1))];
+}
+
+/* ************************************************************************************************/
+
+void *array_tiered_pop_back(array_tiered_s *a)
+{
+    if (NULL == a || a->count < 1)
+        return NULL;
+
+    return array_tiered_pop_at(a, a->count - 1);
+}
+
+/* ************************************************************************************************/
+
+void *array_tiered_pop_front(array_tiered_s *a)
+{
+    return array_tiered_pop_at(a, 0);
+}
+
+/* ************************************************************************************************/
+
+void *array_tiered_pop_at(array_tiered_s *a, size_t pos)
+{
+    if (NULL == a || pos >= a->count)
+        return NULL;
+
+    size_t i = pos >> a->chunk_shift;
+    void *elem =
+        array_tiered_chunk_erase(a, a->chunks[i], pos & (array_tiered_chunk_length(a) - 1));
+
+    /* Rotate the first element of every chunk after the position's one onto the previous chunk */
+    for (size_t j = i + 1; j < a->nchunks; j++) {
+        void *first = array_tiered_chunk_pop_front(a, a->chunks[j]);
+        array_tiered_chunk_push_back(a, a->chunks[j - 1], first);
+    }
+
+    a->count--;
+
+    if (0 == a->chunks[a->nchunks - 1]->count)
+        free(a->chunks[--a->nchunks]);
+
+    /* Shorten the chunks once they get far longer than the no. of chunks; if it fails, the array
+       is just left as it is */
+    size_t quarter = array_tiered_chunk_length(a) / 4;
+
+    if (a->chunk_shift > ARRAY_TIERED_MIN_CHUNK_SHIFT && a->count < quarter * quarter)
+        array_tiered_rechunk(a, a->chunk_shift - 1);
+
+    return elem;
+}
+
+/* ************************************************************************************************/
+
+void *array_tiered_replace(array_tiered_s *a, void *elem, size_t pos)
+{
+    if (NULL == a || pos >= a->count)
+        return NULL;
+
+    chunk_s *c = a->chunks[pos >> a->chunk_shift];
+    size_t slot = array_tiered_slot(a, c, pos & (array_tiered_chunk_length(a) - 1));
+    void *old_elem = c->elems[slot];
+    c->elems[slot] = elem;
+
+    return old_elem;
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_tiered_traverse(array_tiered_s *a, void (*elem_visit)(void *))
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    if (0 == a->count)
+        return ARRAY_RC_EMPTY;
+
+    if (NULL == elem_visit)
+        return ARRAY_RC_ELEM_CB_NULL;
+
+    for (size_t i = 0; i < a->nchunks; i++) {
+        chunk_s *c = a->chunks[i];
+
+        for (size_t j = 0; j < c->count; j++)
+            elem_visit(c->elems[array_tiered_slot(a, c, j)]);
+    }
+
+    return ARRAY_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_tiered_clear(array_tiered_s *a, void (*elem_destroy)(void **))
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    if (0 == a->count)
+        return ARRAY_RC_EMPTY;
+
+    array_rc_e rc = (NULL == elem_destroy ? ARRAY_RC_ELEM_CB_NULL : ARRAY_RC_OK);
+
+    for (size_t i = 0; i < a->nchunks; i++) {
+        chunk_s *c = a->chunks[i];
+
+        for (size_t j = 0; j < c->count && NULL != elem_destroy; j++) {
+            void *elem = c->elems[array_tiered_slot(a, c, j)];
+            elem_destroy(&elem);
+        }
+
+        free(c);
+    }
+
+    free(a->chunks);
+    array_init_tiered(a);
+
+    return rc;
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_tiered_destroy(array_tiered_s **a, void (*elem_destroy)(void **))
+{
+    if (NULL == a || NULL == *a)
+        return ARRAY_RC_NULL;
+
+    array_rc_e rc = array_tiered_clear(*a, elem_destroy);
+
+    free((*a)->chunks);
+    free(*a);
+    *a = NULL;
+
+    return rc;
+}
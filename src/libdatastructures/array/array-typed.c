@@ -0,0 +1,309 @@
+/**
+ * \file   array-typed.c
+ * \brief  Typed (value) array - functions definitions
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "libdatastructures/array/array-typed.h"
+
+/** The length a typed array gets when it first grows from an empty storage */
+#define ARRAY_TYPED_MIN_GROWN_LENGTH 8
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Get the address of the element on a given position of the typed array storage.
+ * \param   a    the array whose element address is to be gotten
+ * \param   pos  the position of the element
+ * \return  pointer to the element
+ */
+static unsigned char *array_typed_elem(array_typed_s *a, size_t pos)
+{
+    return (unsigned char *)a->elems + pos * a->elem_size;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Reallocate the typed array storage so it gets a new length, keeping the elements.
+ * \param   a       the array whose storage is to be reallocated
+ * \param   length  the new length of the array; it must not be less than the no. of elements
+ * \return  the return code for the reallocation
+ */
+static array_rc_e array_typed_resize(array_typed_s *a, size_t length)
+{
+    if (0 == length) {
+        free(a->elems);
+        a->elems = NULL;
+        a->length = 0;
+
+        return ARRAY_RC_OK;
+    }
+
+    if (0 == a->elem_size || length > SIZE_MAX / a->elem_size)
+        return ARRAY_RC_NODE_ALLOC_ERR;
+
+    void *elems = realloc(a->elems, length * a->elem_size);
+
+    if (NULL == elems)
+        return ARRAY_RC_NODE_ALLOC_ERR;
+
+    a->elems = elems;
+    a->length = length;
+
+    return ARRAY_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+void array_init_typed(array_typed_s *a, size_t elem_size, size_t capacity)
+{
+    if (NULL != a) {
+        a->elem_size = elem_size;
+        a->length = 0;
+        a->elems = NULL;
+        a->count = 0;
+
+        if (0 != elem_size)
+            array_typed_resize(a, capacity);
+    }
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+array_typed_s *array_new_typed(size_t elem_size, size_t capacity)
+{
+    if (0 == elem_size)
+        return NULL;
+
+    array_typed_s *a = (array_typed_s *)malloc(sizeof(array_typed_s));
+
+    array_init_typed(a, elem_size, capacity);
+
+    return a;
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_typed_reserve(array_typed_s *a, size_t capacity)
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    if (capacity <= a->length)
+        return ARRAY_RC_OK;
+
+    return array_typed_resize(a, capacity);
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_typed_push_back(array_typed_s *a, const void *elem)
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    return array_typed_push_at(a, elem, a->count);
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_typed_push_front(array_typed_s *a, const void *elem)
+{
+    return array_typed_push_at(a, elem, 0);
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_typed_push_at(array_typed_s *a, const void *elem, size_t pos)
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    if (NULL == elem)
+        return ARRAY_RC_ELEM_NULL;
+
+    if (pos > a->count)
+        return ARRAY_RC_INVALID_POS;
+
+    /* The element may be one of the array's own, which the resize and the shift below move, so
+       its position is recorded instead of its address */
+    uintptr_t begin = (uintptr_t)a->elems;
+    uintptr_t addr = (uintptr_t)elem;
+    bool own_elem = (NULL != a->elems && addr >= begin && addr < begin + a->count * a->elem_size);
+    size_t own_pos = (own_elem ? (addr - begin) / a->elem_size : 0);
+
+    if (a->count == a->length) {
+        size_t length = (a->length > SIZE_MAX / 2 ? SIZE_MAX : a->length * 2);
+
+        array_rc_e rc = array_typed_resize(
+            a, length < ARRAY_TYPED_MIN_GROWN_LENGTH ? ARRAY_TYPED_MIN_GROWN_LENGTH : length);
+
+        if (ARRAY_RC_OK != rc)
+            return rc;
+    }
+
+    unsigned char *slot = array_typed_elem(a, pos);
+
+    memmove(slot + a->elem_size, slot, (a->count - pos) * a->elem_size);
+
+    if (own_elem)
+        elem = array_typed_elem(a, own_pos < pos ? own_pos : own_pos + 1);
+
+    memcpy(slot, elem, a->elem_size);
+    a->count++;
+
+    return ARRAY_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+size_t array_typed_count(array_typed_s *a)
+{
+    if (NULL == a)
+        return 0;
+
+    return a->count;
+}
+
+/* ************************************************************************************************/
+
+void *array_typed_data(array_typed_s *a)
+{
+    if (NULL == a || a->count < 1)
+        return NULL;
+
+    return a->elems;
+}
+
+/* ************************************************************************************************/
+
+void *array_typed_pick_back(array_typed_s *a)
+{
+    if (NULL == a || a->count < 1)
+        return NULL;
+
+    return array_typed_elem(a, a->count - 1);
+}
+
+/* ************************************************************************************************/
+
+void *array_typed_pick_front(array_typed_s *a)
+{
+    if (NULL == a || a->count < 1)
+        return NULL;
+
+    return a->elems;
+}
+
+/* ************************************************************************************************/
+
+void *array_typed_pick_at(array_typed_s *a, size_t pos)
+{
+    if (NULL == a || pos >= a->count)
+        return NULL;
+
+    return array_typed_elem(a, pos);
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_typed_pop_back(array_typed_s *a, void *elem)
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    if (0 == a->count)
+        return ARRAY_RC_EMPTY;
+
+    return array_typed_pop_at(a, a->count - 1, elem);
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_typed_pop_front(array_typed_s *a, void *elem)
+{
+    return array_typed_pop_at(a, 0, elem);
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_typed_pop_at(array_typed_s *a, size_t pos, void *elem)
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    if (0 == a->count)
+        return ARRAY_RC_EMPTY;
+
+    if (pos >= a->count)
+        return ARRAY_RC_INVALID_POS;
+
+    unsigned char *slot = array_typed_elem(a, pos);
+
+    if (NULL != elem)
+        memcpy(elem, slot, a->elem_size);
+
+    memmove(slot, slot + a->elem_size, (a->count - pos - 1) * a->elem_size);
+    a->count--;
+
+    return ARRAY_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_typed_traverse(array_typed_s *a, void (*elem_visit)(void *))
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    if (0 == a->count)
+        return ARRAY_RC_EMPTY;
+
+    if (NULL == elem_visit)
+        return ARRAY_RC_ELEM_CB_NULL;
+
+    unsigned char *elem = (unsigned char *)a->elems;
+
+    for (size_t i = 0; i < a->count; i++) {
+        elem_visit(elem);
+        elem += a->elem_size;
+    }
+
+    return ARRAY_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_typed_clear(array_typed_s *a)
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    if (0 == a->count)
+        return ARRAY_RC_EMPTY;
+
+    a->count = 0;
+
+    return ARRAY_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_typed_destroy(array_typed_s **a)
+{
+    if (NULL == a || NULL == *a)
+        return ARRAY_RC_NULL;
+
+    array_rc_e rc = array_typed_clear(*a);
+
+    free((*a)->elems);
+    free(*a);
+    *a = NULL;
+
+    return rc;
+}
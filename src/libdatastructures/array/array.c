@@ -3,19 +3,288 @@
  * \brief  Array data structure - functions definitions
  */
 
+#include <limits.h>
+#include <pthread.h>
+#include <stdint.h>
 #include <stdlib.h>
-#include "libdatastructures/array/array-node.h"
+#include <string.h>
+#include <unistd.h>
 #include "libdatastructures/array/array.h"
 
+/** The length a growable array gets when it first grows from an empty storage */
+#define ARRAY_MIN_GROWN_LENGTH 8
+
+/** The length of the runs of elements which are sorted by insertion instead of by partitioning */
+#define ARRAY_SORT_INSERTION_LENGTH 16
+
+/** The no. of bits of the key which are sorted by each pass of the radix sort */
+#define ARRAY_SORT_RADIX_BITS 8
+
+/** The no. of buckets of each pass of the radix sort */
+#define ARRAY_SORT_RADIX_BUCKETS (1 << ARRAY_SORT_RADIX_BITS)
+
+/** The no. of passes of the radix sort needed to sort a whole key */
+#define ARRAY_SORT_RADIX_PASSES (64 / ARRAY_SORT_RADIX_BITS)
+
+/** The alignment of the accumulators of a parallel reduction, which keeps each one of them on its
+    own cache line */
+#define ARRAY_PARALLEL_ACC_ALIGN 64
+
+/** A chunk of array elements handled by a single thread of a parallel operation */
+struct array_parallel_chunk {
+    /** The array whose elements are handled */
+    array_s *a;
+    /** Position of the first element of the chunk */
+    size_t first;
+    /** No. of elements of the chunk */
+    size_t n;
+    /** Callback function which visits the elements (for a parallel traversal) */
+    void (*elem_visit)(void *);
+    /** Callback function which accumulates the elements (for a parallel reduction) */
+    void (*elem_accumulate)(void *, void *);
+    /** The accumulator of the chunk (for a parallel reduction) */
+    void *acc;
+    /** The thread which handles the chunk */
+    pthread_t thread;
+    /** Boolean indicating whether the thread which handles the chunk has been created */
+    bool spawned;
+};
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Wrap an index around the end of the array storage.
+ * \param   a      the array whose storage is to be indexed
+ * \param   index  the index to be wrapped, less than twice the length of the array
+ * \return  the index of a valid slot of the storage
+ */
+static size_t array_wrap(array_s *a, size_t index)
+{
+    return (index >= a->length ? index - a->length : index);
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Get the slot of the storage where the element on a given position of the array is.
+ * \param   a    the array whose slot is to be gotten
+ * \param   pos  the position of the element, from zero up to the length of the array
+ * \return  the index of the slot, wrapped around the end of the storage
+ */
+static size_t array_slot(array_s *a, size_t pos)
+{
+    return array_wrap(a, a->front + pos);
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Convert a position given as an 'int' to a 'size_t' one, mapping the negative positions
+ *          to ARRAY_POS_NONE, which is never a valid position.
+ * \param   pos  the position to be converted
+ * \return  the converted position
+ */
+static size_t array_int_pos(int pos)
+{
+    return (pos < 0 ? ARRAY_POS_NONE : (size_t)pos);
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Shift a run of consecutive elements of the array by a number of slots, moving them as
+ *         whole blocks (at most three, depending on how they wrap around the end of the storage).
+ * \param  a        the array whose elements are to be shifted
+ * \param  pos      the position of the first element to be shifted
+ * \param  n        the number of elements to be shifted
+ * \param  k        the number of slots the elements are to be shifted by
+ * \param  to_back  whether the elements are to be shifted towards the back (or the front)
+ */
+static void array_shift(array_s *a, size_t pos, size_t n, size_t k, bool to_back)
+{
+    size_t src = array_slot(a, pos);
+    size_t dst = array_wrap(a, to_back ? src + k : src + a->length - k);
+
+    if (to_back) {
+        /* Move the blocks from the last to the first one, so no element is overwritten before
+           being moved */
+        while (n > 0) {
+            size_t src_last = array_wrap(a, src + n - 1);
+            size_t dst_last = array_wrap(a, dst + n - 1);
+            size_t chunk = (src_last < dst_last ? src_last : dst_last) + 1;
+
+            if (chunk > n)
+                chunk = n;
+
+            memmove(&a->elems[dst_last + 1 - chunk], &a->elems[src_last + 1 - chunk],
+                    chunk * sizeof(void *));
+            n -= chunk;
+        }
+    } else {
+        while (n > 0) {
+            size_t chunk = a->length - (src > dst ? src : dst);
+
+            if (chunk > n)
+                chunk = n;
+
+            memmove(&a->elems[dst], &a->elems[src], chunk * sizeof(void *));
+            src = array_wrap(a, src + chunk);
+            dst = array_wrap(a, dst + chunk);
+            n -= chunk;
+        }
+    }
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Reallocate the array storage so it gets a new length, keeping the stored elements.
+ * \param   a       the array whose storage is to be reallocated
+ * \param   length  the new length of the array; it must not be less than the no. of elements
+ * \return  the return code for the reallocation
+ */
+static array_rc_e array_resize(array_s *a, size_t length)
+{
+    if (length > SIZE_MAX / sizeof(void *))
+        return ARRAY_RC_NODE_ALLOC_ERR;
+
+    if (0 == length) {
+        free(a->elems);
+        a->elems = NULL;
+        a->length = 0;
+        a->front = 0;
+
+        return ARRAY_RC_OK;
+    }
+
+    void **elems;
+
+    if (a->front + a->count <= (length < a->length ? length : a->length)) {
+        /* The elements neither wrap around the end of the old storage nor go beyond the end of
+           the new one, so they can be kept right where they are */
+        elems = (void **)realloc(a->elems, length * sizeof(void *));
+
+        if (NULL == elems)
+            return ARRAY_RC_NODE_ALLOC_ERR;
+    } else {
+        /* Otherwise, unwrap them onto the beginning of a brand new storage */
+        elems = (void **)malloc(length * sizeof(void *));
+
+        if (NULL == elems)
+            return ARRAY_RC_NODE_ALLOC_ERR;
+
+        size_t first_part = a->length - a->front;
+
+        if (first_part > a->count)
+            first_part = a->count;
+
+        memcpy(elems, &a->elems[a->front], first_part * sizeof(void *));
+        memcpy(&elems[first_part], a->elems, (a->count - first_part) * sizeof(void *));
+
+        free(a->elems);
+        a->front = 0;
+    }
+
+    a->elems = elems;
+    a->length = length;
+
+    return ARRAY_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Make room for more elements in the array, at least doubling the length of a growable
+ *          array if they don't fit.
+ * \param   a  the array which is to store more elements
+ * \param   n  the number of elements to make room for
+ * \return  the return code for the operation
+ */
+static array_rc_e array_make_room(array_s *a, size_t n)
+{
+    if (n <= a->length - a->count)
+        return ARRAY_RC_OK;
+
+    if (!a->growable)
+        return ARRAY_RC_FULL;
+
+    if (n > SIZE_MAX - a->count)
+        return ARRAY_RC_NODE_ALLOC_ERR;
+
+    size_t length = (a->length > SIZE_MAX / 2 ? SIZE_MAX : a->length * 2);
+
+    if (length < ARRAY_MIN_GROWN_LENGTH)
+        length = ARRAY_MIN_GROWN_LENGTH;
+
+    if (length < a->count + n)
+        length = a->count + n;
+
+    return array_resize(a, length);
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Open a gap of empty slots on a given position of the array, shifting whichever side of
+ *         the array has the fewer elements. The array must have room for the new slots.
+ * \param  a    the array where the gap is to be opened
+ * \param  pos  the position of the gap
+ * \param  n    the number of empty slots
+ */
+static void array_open_gap(array_s *a, size_t pos, size_t n)
+{
+    if (pos < a->count - pos) {
+        array_shift(a, 0, pos, n, false);
+        a->front = array_wrap(a, a->front + a->length - n);
+    } else {
+        array_shift(a, pos, a->count - pos, n, true);
+    }
+
+    a->count += n;
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Close a gap of slots on a given position of the array (whose elements have already been
+ *         taken away), shifting whichever side of the array has the fewer elements.
+ * \param  a    the array where the gap is to be closed
+ * \param  pos  the position of the gap
+ * \param  n    the number of slots of the gap
+ */
+static void array_close_gap(array_s *a, size_t pos, size_t n)
+{
+    if (pos < a->count - pos - n) {
+        array_shift(a, 0, pos, n, true);
+        a->front = array_slot(a, n);
+    } else {
+        array_shift(a, pos + n, a->count - pos - n, n, false);
+    }
+
+    a->count -= n;
+
+    if (0 == a->count)
+        a->front = 0;
+
+    return;
+}
+
 /* ************************************************************************************************/
 
 void array_init(array_s *a, size_t length)
 {
     if (NULL != a) {
-        *(size_t *)&a->length = length;
+        a->length = 0;
+        a->elems = NULL;
+        a->front = 0;
         a->count = 0;
+        a->growable = false;
 
-        a->elems = (array_node_s **)calloc((size_t)length, sizeof(array_node_s *));
+        array_resize(a, length);
     }
 
     return;
@@ -34,15 +303,76 @@ array_s *array_new(size_t length)
 
 /* ************************************************************************************************/
 
-array_rc_e array_push_back(array_s *a, void *elem)
+void array_init_growable(array_s *a, size_t capacity)
+{
+    if (NULL != a) {
+        array_init(a, capacity);
+        a->growable = true;
+    }
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+array_s *array_new_growable(size_t capacity)
+{
+    array_s *a = (array_s *)malloc(sizeof(array_s));
+
+    array_init_growable(a, capacity);
+
+    return a;
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_reserve(array_s *a, size_t capacity)
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    if (capacity <= a->length)
+        return ARRAY_RC_OK;
+
+    return array_resize(a, capacity);
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_shrink_to_fit(array_s *a)
 {
     if (NULL == a)
         return ARRAY_RC_NULL;
 
     if (a->count == a->length)
-        return ARRAY_RC_FULL;
+        return ARRAY_RC_OK;
+
+    return array_resize(a, a->count);
+}
+
+/* ************************************************************************************************/
+
+size_t array_capacity(array_s *a)
+{
+    if (NULL == a)
+        return 0;
+
+    return a->length;
+}
+
+/* ************************************************************************************************/
 
-    a->elems[a->count] = array_node_new(elem);
+array_rc_e array_push_back(array_s *a, void *elem)
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    array_rc_e rc = array_make_room(a, 1);
+
+    if (ARRAY_RC_OK != rc)
+        return rc;
+
+    a->elems[array_slot(a, a->count)] = elem;
     a->count++;
 
     return ARRAY_RC_OK;
@@ -55,13 +385,13 @@ array_rc_e array_push_front(array_s *a, void *elem)
     if (NULL == a)
         return ARRAY_RC_NULL;
 
-    if (a->count == a->length)
-        return ARRAY_RC_FULL;
+    array_rc_e rc = array_make_room(a, 1);
 
-    for (int i = (int)a->count; i > 0; i--)
-        a->elems[i] = a->elems[i - 1];
+    if (ARRAY_RC_OK != rc)
+        return rc;
 
-    a->elems[0] = array_node_new(elem);
+    a->front = (0 == a->front ? a->length : a->front) - 1;
+    a->elems[a->front] = elem;
     a->count++;
 
     return ARRAY_RC_OK;
@@ -70,21 +400,60 @@ array_rc_e array_push_front(array_s *a, void *elem)
 /* ************************************************************************************************/
 
 array_rc_e array_push_at(array_s *a, void *elem, int pos)
+{
+    return array_push_at_idx(a, elem, array_int_pos(pos));
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_push_at_idx(array_s *a, void *elem, size_t pos)
 {
     if (NULL == a)
         return ARRAY_RC_NULL;
 
-    if (a->count == a->length)
-        return ARRAY_RC_FULL;
+    if (pos > a->count)
+        return ARRAY_RC_INVALID_POS;
+
+    array_rc_e rc = array_make_room(a, 1);
 
-    if (pos < 0 || pos > (int)a->count)
+    if (ARRAY_RC_OK != rc)
+        return rc;
+
+    array_open_gap(a, pos, 1);
+    a->elems[array_slot(a, pos)] = elem;
+
+    return ARRAY_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_insert_range(array_s *a, size_t pos, void **elems, size_t n)
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    if (pos > a->count)
         return ARRAY_RC_INVALID_POS;
 
-    for (int i = (int)a->count; i > pos; i--)
-        a->elems[i] = a->elems[i - 1];
+    if (NULL == elems && n > 0)
+        return ARRAY_RC_ELEM_NULL;
 
-    a->elems[pos] = array_node_new(elem);
-    a->count++;
+    array_rc_e rc = array_make_room(a, n);
+
+    if (ARRAY_RC_OK != rc || 0 == n)
+        return rc;
+
+    array_open_gap(a, pos, n);
+
+    /* Copy the new elements onto the gap, which may wrap around the end of the storage */
+    size_t slot = array_slot(a, pos);
+    size_t first_part = a->length - slot;
+
+    if (first_part > n)
+        first_part = n;
+
+    memcpy(&a->elems[slot], elems, first_part * sizeof(void *));
+    memcpy(a->elems, &elems[first_part], (n - first_part) * sizeof(void *));
 
     return ARRAY_RC_OK;
 }
@@ -106,7 +475,7 @@ void *array_pick_back(array_s *a)
     if (NULL == a || a->count < 1)
         return NULL;
 
-    return a->elems[a->count - 1]->elem;
+    return a->elems[array_slot(a, a->count - 1)];
 }
 
 /* ************************************************************************************************/
@@ -116,17 +485,24 @@ void *array_pick_front(array_s *a)
     if (NULL == a || a->count < 1)
         return NULL;
 
-    return a->elems[0]->elem;
+    return a->elems[a->front];
 }
 
 /* ************************************************************************************************/
 
 void *array_pick_at(array_s *a, int pos)
 {
-    if (NULL == a || pos < 0 || pos > (int)a->count - 1)
+    return array_pick_at_idx(a, array_int_pos(pos));
+}
+
+/* ************************************************************************************************/
+
+void *array_pick_at_idx(array_s *a, size_t pos)
+{
+    if (NULL == a || pos >= a->count)
         return NULL;
 
-    return a->elems[pos]->elem;
+    return a->elems[array_slot(a, pos)];
 }
 
 /* ************************************************************************************************/
@@ -136,7 +512,7 @@ void *array_pop_back(array_s *a)
     if (NULL == a || a->count < 1)
         return NULL;
 
-    void *elem = array_node_destroy(&a->elems[a->count - 1]);
+    void *elem = a->elems[array_slot(a, a->count - 1)];
     a->count--;
 
     return elem;
@@ -149,12 +525,8 @@ void *array_pop_front(array_s *a)
     if (NULL == a || a->count < 1)
         return NULL;
 
-    void *elem = array_node_destroy(&a->elems[0]);
-
-    for (int i = 0; i < (int)a->count - 1; i++)
-        a->elems[i] = a->elems[i + 1];
-
-    a->elems[a->count - 1] = NULL;
+    void *elem = a->elems[a->front];
+    a->front = array_slot(a, 1);
     a->count--;
 
     return elem;
@@ -164,29 +536,71 @@ void *array_pop_front(array_s *a)
 
 void *array_pop_at(array_s *a, int pos)
 {
-    if (NULL == a || a->count < 1 || pos < 0 || pos > (int)a->count - 1)
-        return NULL;
+    return array_pop_at_idx(a, array_int_pos(pos));
+}
 
-    void *elem = array_node_destroy(&a->elems[pos]);
+/* ************************************************************************************************/
 
-    for (int i = pos; i < (int)a->count - 1; i++)
-        a->elems[i] = a->elems[i + 1];
+void *array_pop_at_idx(array_s *a, size_t pos)
+{
+    if (NULL == a || pos >= a->count)
+        return NULL;
 
-    a->elems[a->count - 1] = NULL;
-    a->count--;
+    void *elem = a->elems[array_slot(a, pos)];
+
+    array_close_gap(a, pos, 1);
 
     return elem;
 }
 
 /* ************************************************************************************************/
 
+array_rc_e array_erase_range(array_s *a, size_t pos, size_t n, void (*elem_destroy)(void **))
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    if (0 == a->count)
+        return ARRAY_RC_EMPTY;
+
+    if (pos > a->count || n > a->count - pos)
+        return ARRAY_RC_INVALID_POS;
+
+    array_rc_e rc = (NULL == elem_destroy ? ARRAY_RC_ELEM_CB_NULL : ARRAY_RC_OK);
+
+    if (NULL != elem_destroy) {
+        size_t slot = array_slot(a, pos);
+
+        for (size_t i = 0; i < n; i++) {
+            elem_destroy(&a->elems[slot]);
+
+            if (++slot == a->length)
+                slot = 0;
+        }
+    }
+
+    array_close_gap(a, pos, n);
+
+    return rc;
+}
+
+/* ************************************************************************************************/
+
 void *array_replace(array_s *a, void *elem, int pos)
 {
-    if (NULL == a || pos < 0 || pos > (int)a->count - 1)
+    return array_replace_idx(a, elem, array_int_pos(pos));
+}
+
+/* ************************************************************************************************/
+
+void *array_replace_idx(array_s *a, void *elem, size_t pos)
+{
+    if (NULL == a || pos >= a->count)
         return NULL;
 
-    void *old_elem = a->elems[pos]->elem;
-    a->elems[pos]->elem = elem;
+    size_t slot = array_slot(a, pos);
+    void *old_elem = a->elems[slot];
+    a->elems[slot] = elem;
 
     return old_elem;
 }
@@ -194,6 +608,13 @@ void *array_replace(array_s *a, void *elem, int pos)
 /* ************************************************************************************************/
 
 array_rc_e array_swap(array_s *a, int pos1, int pos2)
+{
+    return array_swap_idx(a, array_int_pos(pos1), array_int_pos(pos2));
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_swap_idx(array_s *a, size_t pos1, size_t pos2)
 {
     if (NULL == a)
         return ARRAY_RC_NULL;
@@ -201,13 +622,15 @@ array_rc_e array_swap(array_s *a, int pos1, int pos2)
     if (a->count < 1)
         return ARRAY_RC_EMPTY;
 
-    if (pos1 < 0 || pos1 > (int)a->count - 1 || pos2 < 0 || pos2 > (int)a->count - 1 ||
-        pos1 == pos2)
+    if (pos1 >= a->count || pos2 >= a->count || pos1 == pos2)
         return ARRAY_RC_INVALID_POS;
 
-    void *tmp = a->elems[pos1]->elem;
-    a->elems[pos1]->elem = a->elems[pos2]->elem;
-    a->elems[pos2]->elem = tmp;
+    size_t slot1 = array_slot(a, pos1);
+    size_t slot2 = array_slot(a, pos2);
+
+    void *tmp = a->elems[slot1];
+    a->elems[slot1] = a->elems[slot2];
+    a->elems[slot2] = tmp;
 
     return ARRAY_RC_OK;
 }
@@ -216,17 +639,30 @@ array_rc_e array_swap(array_s *a, int pos1, int pos2)
 
 int array_find_next(array_s *a, void *elem, int start_pos, int (*elem_compare)(void *, void *))
 {
-    if (NULL == a || NULL == elem_compare || a->count < 1 || start_pos < 0 ||
-        start_pos > (int)a->count - 1)
-        return -1;
+    size_t found = array_find_next_idx(a, elem, array_int_pos(start_pos), elem_compare);
+
+    return (found > INT_MAX ? -1 : (int)found);
+}
+
+/* ************************************************************************************************/
+
+size_t array_find_next_idx(array_s *a, void *elem, size_t start_pos,
+                           int (*elem_compare)(void *, void *))
+{
+    if (NULL == a || NULL == elem_compare || start_pos >= a->count)
+        return ARRAY_POS_NONE;
 
-    int found = -1;
+    size_t found = ARRAY_POS_NONE;
+    size_t slot = array_slot(a, start_pos);
 
-    for (int i = start_pos; i < (int)a->count; i++) {
-        if (0 == elem_compare(elem, a->elems[i]->elem)) {
+    for (size_t i = start_pos; i < a->count; i++) {
+        if (0 == elem_compare(elem, a->elems[slot])) {
             found = i;
             break;
         }
+
+        if (++slot == a->length)
+            slot = 0;
     }
 
     return found;
@@ -234,6 +670,383 @@ int array_find_next(array_s *a, void *elem, int start_pos, int (*elem_compare)(v
 
 /* ************************************************************************************************/
 
+/**
+ * \brief  Swap the elements stored in two slots of the array storage.
+ * \param  slot1  the first slot
+ * \param  slot2  the second slot
+ */
+static void array_swap_slots(void **slot1, void **slot2)
+{
+    void *tmp = *slot1;
+    *slot1 = *slot2;
+    *slot2 = tmp;
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Reverse the order of the slots in a range of the array storage.
+ * \param  elems  the first slot of the range
+ * \param  n      the number of slots in the range
+ */
+static void array_reverse_slots(void **elems, size_t n)
+{
+    for (size_t i = 0, j = n; i + 1 < j; i++, j--)
+        array_swap_slots(&elems[i], &elems[j - 1]);
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Make the array elements contiguous in its storage, rotating the storage in place (by
+ *          reversing it) if they wrap around its end.
+ * \param   a  the array whose elements are to be made contiguous
+ * \return  pointer to the slot of the first element
+ */
+static void **array_make_contiguous(array_s *a)
+{
+    if (a->front + a->count > a->length) {
+        array_reverse_slots(a->elems, a->front);
+        array_reverse_slots(&a->elems[a->front], a->length - a->front);
+        array_reverse_slots(a->elems, a->length);
+        a->front = 0;
+    }
+
+    return &a->elems[a->front];
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Sort a run of contiguous elements by insertion.
+ * \param  elems         the first element of the run
+ * \param  n             the number of elements in the run
+ * \param  elem_compare  pointer to a callback function used to compare two elements
+ */
+static void array_insertion_sort(void **elems, size_t n, int (*elem_compare)(void *, void *))
+{
+    for (size_t i = 1; i < n; i++) {
+        void *elem = elems[i];
+        size_t j = i;
+
+        for (; j > 0 && elem_compare(elem, elems[j - 1]) > 0; j--)
+            elems[j] = elems[j - 1];
+
+        elems[j] = elem;
+    }
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Sort a run of contiguous elements by heapsort.
+ * \param  elems         the first element of the run
+ * \param  n             the number of elements in the run
+ * \param  elem_compare  pointer to a callback function used to compare two elements
+ */
+static void array_heap_sort(void **elems, size_t n, int (*elem_compare)(void *, void *))
+{
+    for (size_t end = n, i = n / 2; end > 1;) {
+        void *elem;
+
+        /* Firstly build a max-heap, then repeatedly move its root onto the end of the run */
+        if (i > 0) {
+            elem = elems[--i];
+        } else {
+            elem = elems[--end];
+            elems[end] = elems[0];
+        }
+
+        size_t parent = i, child;
+
+        while ((child = 2 * parent + 1) < end) {
+            if (child + 1 < end && elem_compare(elems[child], elems[child + 1]) > 0)
+                child++;
+
+            if (elem_compare(elem, elems[child]) <= 0)
+                break;
+
+            elems[parent] = elems[child];
+            parent = child;
+        }
+
+        elems[parent] = elem;
+    }
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Sort a run of contiguous elements by introsort.
+ * \param  elems         the first element of the run
+ * \param  n             the number of elements in the run
+ * \param  depth         the no. of partitionings left before falling back to heapsort
+ * \param  elem_compare  pointer to a callback function used to compare two elements
+ */
+static void array_intro_sort(void **elems, size_t n, size_t depth,
+                             int (*elem_compare)(void *, void *))
+{
+    while (n > ARRAY_SORT_INSERTION_LENGTH) {
+        if (0 == depth) {
+            array_heap_sort(elems, n, elem_compare);
+            return;
+        }
+
+        depth--;
+
+        /* Take the median of the first, middle and last elements as the pivot, moving it onto the
+           first slot */
+        size_t mid = n / 2;
+
+        if (elem_compare(elems[0], elems[mid]) < 0)
+            array_swap_slots(&elems[0], &elems[mid]);
+
+        if (elem_compare(elems[mid], elems[n - 1]) < 0) {
+            array_swap_slots(&elems[mid], &elems[n - 1]);
+
+            if (elem_compare(elems[0], elems[mid]) < 0)
+                array_swap_slots(&elems[0], &elems[mid]);
+        }
+
+        array_swap_slots(&elems[0], &elems[mid]);
+
+        void *pivot = elems[0];
+        size_t i = 0, j = n;
+
+        for (;;) {
+            while (++i < n && elem_compare(elems[i], pivot) > 0)
+                ;
+
+            while (elem_compare(pivot, elems[--j]) > 0)
+                ;
+
+            if (i >= j)
+                break;
+
+            array_swap_slots(&elems[i], &elems[j]);
+        }
+
+        elems[0] = elems[j];
+        elems[j] = pivot;
+
+        /* Recurse into the shorter side only, so the stack depth is logarithmic */
+        if (j < n - j - 1) {
+            array_intro_sort(elems, j, depth, elem_compare);
+            elems += j + 1;
+            n -= j + 1;
+        } else {
+            array_intro_sort(&elems[j + 1], n - j - 1, depth, elem_compare);
+            n = j;
+        }
+    }
+
+    array_insertion_sort(elems, n, elem_compare);
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_sort(array_s *a, int (*elem_compare)(void *, void *))
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    if (0 == a->count)
+        return ARRAY_RC_EMPTY;
+
+    if (NULL == elem_compare)
+        return ARRAY_RC_ELEM_CB_NULL;
+
+    size_t depth = 0;
+
+    for (size_t n = a->count; n > 1; n >>= 1)
+        depth += 2;
+
+    array_intro_sort(array_make_contiguous(a), a->count, depth, elem_compare);
+
+    return ARRAY_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_sort_by_key(array_s *a, uint64_t (*elem_key)(void *))
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    if (0 == a->count)
+        return ARRAY_RC_EMPTY;
+
+    if (NULL == elem_key)
+        return ARRAY_RC_ELEM_CB_NULL;
+
+    size_t n = a->count;
+
+    if (n > SIZE_MAX / (2 * (sizeof(uint64_t) + sizeof(void *))))
+        return ARRAY_RC_NODE_ALLOC_ERR;
+
+    /* Every pass moves the elements (and their keys, so they're extracted only once) back and
+       forth between the array storage and a temporary buffer */
+    uint64_t *keys = (uint64_t *)malloc(2 * n * sizeof(uint64_t));
+    void **tmp_elems = (void **)malloc(n * sizeof(void *));
+
+    if (NULL == keys || NULL == tmp_elems) {
+        free(keys);
+        free(tmp_elems);
+        return ARRAY_RC_NODE_ALLOC_ERR;
+    }
+
+    size_t counts[ARRAY_SORT_RADIX_PASSES][ARRAY_SORT_RADIX_BUCKETS] = { { 0 } };
+
+    void **src_elems = array_make_contiguous(a), **dst_elems = tmp_elems;
+    uint64_t *src_keys = keys, *dst_keys = &keys[n];
+
+    for (size_t i = 0; i < n; i++) {
+        uint64_t key = src_keys[i] = elem_key(src_elems[i]);
+
+        for (size_t p = 0; p < ARRAY_SORT_RADIX_PASSES; p++) {
+            counts[p][key & (ARRAY_SORT_RADIX_BUCKETS - 1)]++;
+            key >>= ARRAY_SORT_RADIX_BITS;
+        }
+    }
+
+    for (size_t p = 0; p < ARRAY_SORT_RADIX_PASSES; p++) {
+        size_t shift = p * ARRAY_SORT_RADIX_BITS, offset = 0;
+
+        /* Skip the pass if all the keys have the same digit */
+        if (n == counts[p][(src_keys[0] >> shift) & (ARRAY_SORT_RADIX_BUCKETS - 1)])
+            continue;
+
+        for (size_t b = 0; b < ARRAY_SORT_RADIX_BUCKETS; b++) {
+            size_t count = counts[p][b];
+            counts[p][b] = offset;
+            offset += count;
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            size_t dst = counts[p][(src_keys[i] >> shift) & (ARRAY_SORT_RADIX_BUCKETS - 1)]++;
+            dst_elems[dst] = src_elems[i];
+            dst_keys[dst] = src_keys[i];
+        }
+
+        void **tmp = src_elems;
+        src_elems = dst_elems;
+        dst_elems = tmp;
+
+        uint64_t *tmp_keys = src_keys;
+        src_keys = dst_keys;
+        dst_keys = tmp_keys;
+    }
+
+    if (src_elems == tmp_elems)
+        memcpy(dst_elems, src_elems, n * sizeof(void *));
+
+    free(keys);
+    free(tmp_elems);
+
+    return ARRAY_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Find, by binary search, the first position of a sorted array whose element is 'greater'
+ *          than (or, optionally, 'equal' to) a given element.
+ * \param   a             the array where the search will take place
+ * \param   elem          an 'example' element to be compared to the elements in the array
+ * \param   elem_compare  pointer to a callback function used to compare the elements
+ * \param   or_equal      whether to stop at the first element 'equal' to the 'example' one
+ * \return  the position found, or the no. of elements
+ */
+static size_t array_bound(array_s *a, void *elem, int (*elem_compare)(void *, void *),
+                          bool or_equal)
+{
+    size_t pos = 0;
+
+    for (size_t n = a->count; n > 0;) {
+        size_t half = n / 2;
+        int comp = elem_compare(a->elems[array_slot(a, pos + half)], elem);
+
+        if (comp > 0 || (comp == 0 && !or_equal)) {
+            pos += half + 1;
+            n -= half + 1;
+        } else {
+            n = half;
+        }
+    }
+
+    return pos;
+}
+
+/* ************************************************************************************************/
+
+size_t array_lower_bound(array_s *a, void *elem, int (*elem_compare)(void *, void *))
+{
+    if (NULL == a || NULL == elem_compare)
+        return 0;
+
+    return array_bound(a, elem, elem_compare, true);
+}
+
+/* ************************************************************************************************/
+
+size_t array_upper_bound(array_s *a, void *elem, int (*elem_compare)(void *, void *))
+{
+    if (NULL == a || NULL == elem_compare)
+        return 0;
+
+    return array_bound(a, elem, elem_compare, false);
+}
+
+/* ************************************************************************************************/
+
+size_t array_binary_search(array_s *a, void *elem, int (*elem_compare)(void *, void *))
+{
+    if (NULL == a || NULL == elem_compare)
+        return ARRAY_POS_NONE;
+
+    size_t pos = array_bound(a, elem, elem_compare, true);
+
+    if (pos == a->count || 0 != elem_compare(a->elems[array_slot(a, pos)], elem))
+        return ARRAY_POS_NONE;
+
+    return pos;
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_insert_sorted(array_s *a, void *elem, int (*elem_compare)(void *, void *))
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    if (NULL == elem_compare)
+        return ARRAY_RC_ELEM_CB_NULL;
+
+    array_rc_e rc = array_make_room(a, 1);
+
+    if (ARRAY_RC_OK != rc)
+        return rc;
+
+    size_t pos = array_bound(a, elem, elem_compare, false);
+
+    array_open_gap(a, pos, 1);
+    a->elems[array_slot(a, pos)] = elem;
+
+    return ARRAY_RC_OK;
+}
+
+/* ************************************************************************************************/
+
 array_rc_e array_traverse(array_s *a, void (*elem_visit)(void *))
 {
     if (NULL == a)
@@ -245,10 +1058,188 @@ array_rc_e array_traverse(array_s *a, void (*elem_visit)(void *))
     if (NULL == elem_visit)
         return ARRAY_RC_ELEM_CB_NULL;
 
-    for (int i = 0; i < (int)a->count; i++) {
-        elem_visit(a->elems[i]->elem);
+    size_t slot = a->front;
+
+    for (size_t i = 0; i < a->count; i++) {
+        elem_visit(a->elems[slot]);
+
+        if (++slot == a->length)
+            slot = 0;
+    }
+
+    return ARRAY_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Visit or accumulate all the elements of a chunk of a parallel operation.
+ * \param   arg  pointer to the chunk whose elements are to be handled
+ * \return  null
+ */
+static void *array_parallel_run(void *arg)
+{
+    struct array_parallel_chunk *chunk = (struct array_parallel_chunk *)arg;
+    array_s *a = chunk->a;
+    size_t slot = array_slot(a, chunk->first);
+
+    for (size_t i = 0; i < chunk->n; i++) {
+        if (NULL != chunk->elem_visit)
+            chunk->elem_visit(a->elems[slot]);
+        else
+            chunk->elem_accumulate(chunk->acc, a->elems[slot]);
+
+        if (++slot == a->length)
+            slot = 0;
+    }
+
+    return NULL;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Get the no. of chunks the elements of an array are split into by a parallel operation.
+ * \param   a         the array whose elements are to be split
+ * \param   nthreads  the maximum no. of threads to be used (zero for one per online processor)
+ * \return  the no. of chunks, which is at least one
+ */
+static size_t array_parallel_chunks(array_s *a, size_t nthreads)
+{
+    if (0 == nthreads) {
+        long nprocs = sysconf(_SC_NPROCESSORS_ONLN);
+
+        nthreads = (nprocs > 0 ? (size_t)nprocs : 1);
+    }
+
+    size_t grain = (ARRAY_PARALLEL_MIN_GRAIN > 0 ? ARRAY_PARALLEL_MIN_GRAIN : 1);
+    size_t nchunks = a->count / grain;
+
+    if (nchunks > nthreads)
+        nchunks = nthreads;
+
+    return (nchunks > 0 ? nchunks : 1);
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Split the array elements evenly into chunks and handle each one of them on its own
+ *          thread, the first one on the calling thread. A chunk whose thread can't be created is
+ *          handled on the calling thread as well.
+ * \param   chunks   the chunks to be handled, whose fields other than the positions are set
+ * \param   nchunks  the no. of chunks
+ */
+static void array_parallel_spawn(struct array_parallel_chunk *chunks, size_t nchunks)
+{
+    size_t count = chunks[0].a->count;
+    size_t first = 0;
+
+    for (size_t i = 0; i < nchunks; i++) {
+        chunks[i].first = first;
+        chunks[i].n = count / nchunks + (i < count % nchunks ? 1 : 0);
+        first += chunks[i].n;
+    }
+
+    for (size_t i = 1; i < nchunks; i++)
+        chunks[i].spawned =
+            (0 == pthread_create(&chunks[i].thread, NULL, array_parallel_run, &chunks[i]));
+
+    array_parallel_run(&chunks[0]);
+
+    for (size_t i = 1; i < nchunks; i++) {
+        if (chunks[i].spawned)
+            pthread_join(chunks[i].thread, NULL);
+        else
+            array_parallel_run(&chunks[i]);
+    }
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_parallel_for(array_s *a, void (*elem_visit)(void *), size_t nthreads)
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    if (0 == a->count)
+        return ARRAY_RC_EMPTY;
+
+    if (NULL == elem_visit)
+        return ARRAY_RC_ELEM_CB_NULL;
+
+    size_t nchunks = array_parallel_chunks(a, nthreads);
+    struct array_parallel_chunk *chunks =
+        (struct array_parallel_chunk *)malloc(nchunks * sizeof(struct array_parallel_chunk));
+
+    if (NULL == chunks)
+        return ARRAY_RC_NODE_ALLOC_ERR;
+
+    for (size_t i = 0; i < nchunks; i++) {
+        memset(&chunks[i], 0, sizeof(struct array_parallel_chunk));
+        chunks[i].a = a;
+        chunks[i].elem_visit = elem_visit;
     }
 
+    array_parallel_spawn(chunks, nchunks);
+    free(chunks);
+
+    return ARRAY_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+array_rc_e array_parallel_reduce(array_s *a, void (*elem_accumulate)(void *, void *),
+                                 void (*acc_combine)(void *, void *), const void *identity,
+                                 size_t acc_size, void *result, size_t nthreads)
+{
+    if (NULL == a)
+        return ARRAY_RC_NULL;
+
+    if (NULL == elem_accumulate || NULL == acc_combine)
+        return ARRAY_RC_ELEM_CB_NULL;
+
+    if (NULL == identity || NULL == result)
+        return ARRAY_RC_ELEM_NULL;
+
+    memcpy(result, identity, acc_size);
+
+    if (0 == a->count)
+        return ARRAY_RC_EMPTY;
+
+    size_t nchunks = array_parallel_chunks(a, nthreads);
+    size_t lines = (acc_size + ARRAY_PARALLEL_ACC_ALIGN - 1) / ARRAY_PARALLEL_ACC_ALIGN;
+    size_t stride = (lines > 0 ? lines : 1) * ARRAY_PARALLEL_ACC_ALIGN;
+    struct array_parallel_chunk *chunks =
+        (struct array_parallel_chunk *)malloc(nchunks * sizeof(struct array_parallel_chunk));
+    unsigned char *accs =
+        (unsigned char *)aligned_alloc(ARRAY_PARALLEL_ACC_ALIGN, nchunks * stride);
+
+    if (NULL == chunks || NULL == accs) {
+        free(chunks);
+        free(accs);
+
+        return ARRAY_RC_NODE_ALLOC_ERR;
+    }
+
+    for (size_t i = 0; i < nchunks; i++) {
+        memset(&chunks[i], 0, sizeof(struct array_parallel_chunk));
+        chunks[i].a = a;
+        chunks[i].elem_accumulate = elem_accumulate;
+        chunks[i].acc = accs + i * stride;
+        memcpy(chunks[i].acc, identity, acc_size);
+    }
+
+    array_parallel_spawn(chunks, nchunks);
+
+    for (size_t i = 0; i < nchunks; i++)
+        acc_combine(result, chunks[i].acc);
+
+    free(accs);
+    free(chunks);
+
     return ARRAY_RC_OK;
 }
 
@@ -264,13 +1255,19 @@ array_rc_e array_clear(array_s *a, void (*elem_destroy)(void **))
 
     array_rc_e rc = (NULL == elem_destroy ? ARRAY_RC_ELEM_CB_NULL : ARRAY_RC_OK);
 
-    for (int i = 0; i < (int)a->count; i++) {
-        void *elem = array_node_destroy(&a->elems[i]);
+    size_t slot = a->front;
+
+    for (size_t i = 0; i < a->count; i++) {
+        void *elem = a->elems[slot];
 
         if (NULL != elem_destroy)
             elem_destroy(&elem);
+
+        if (++slot == a->length)
+            slot = 0;
     }
 
+    a->front = 0;
     a->count = 0;
 
     return rc;
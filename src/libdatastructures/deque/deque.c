@@ -2,49 +2,176 @@
  * \file   deque.c
  * \brief  Doubly-ended queue ("deque") data structure - functions definitions
  */
+#include <stdbool.h>
 #include <stdlib.h>
-#include "libdatastructures/list/doubly-linked-list.h"
+#include <string.h>
 #include "libdatastructures/deque/deque.h"
 
+/** Initial length of the map of blocks, allocated as the first block is */
+#define DEQUE_MAP_INIT_LENGTH 8
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Allocate a block for the deque, reusing its spare block if any.
+ * \param   deque  the deque the block is to be allocated for
+ * \return  the new block, or null if its allocation has failed
+ */
+static void **deque_block_alloc(deque_s *deque)
+{
+    void **block = deque->spare;
+
+    if (NULL != block) {
+        deque->spare = NULL;
+        return block;
+    }
+
+    if (NULL != deque->pool)
+        return (void **)node_pool_alloc(deque->pool);
+
+    return (void **)malloc(DEQUE_BLOCK_LENGTH * sizeof(void *));
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Deallocate a block of the deque, back to the pool it was allocated out of (if any).
+ * \param  deque  the deque the block belongs to
+ * \param  block  the block to be deallocated
+ */
+static void deque_block_free(deque_s *deque, void **block)
+{
+    if (NULL != deque->pool)
+        node_pool_free(deque->pool, block);
+    else
+        free(block);
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Release an emptied block of the deque, which is kept as its spare block if it has none
+ *         (so pushing and popping elements around the boundary of a block doesn't call the
+ *         allocator), or deallocated otherwise.
+ * \param  deque  the deque the block belongs to
+ * \param  block  the block to be released
+ */
+static void deque_block_release(deque_s *deque, void **block)
+{
+    if (NULL == deque->spare)
+        deque->spare = block;
+    else
+        deque_block_free(deque, block);
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Release all the blocks of the deque, making it empty (its map is kept).
+ * \param  deque  the deque whose blocks are to be released
+ */
+static void deque_blocks_release(deque_s *deque)
+{
+    for (size_t i = 0; i < deque->nblocks; i++)
+        deque_block_release(deque, deque->map[deque->first_block + i]);
+
+    deque->first_block = deque->map_length / 2;
+    deque->nblocks = 0;
+    deque->front = 0;
+    deque->count = 0;
+
+    return;
+}
+
 /* ************************************************************************************************/
 
 /**
- * \brief   Convert a circ. doubly linked list return code to a deque one
- * \param   rc  the circular doubly linked list operation return code
- * \return  an equivalent deque operation return code
+ * \brief   Make room in the map for a new block at the front or at the back of the deque, either
+ *          by moving the blocks in use back to the middle of the map (if they fill less than half
+ *          of it) or by doubling its length.
+ * \param   deque     the deque whose map is to have room for a new block
+ * \param   at_front  whether the room is to be made at the front of the deque (or at its back)
+ * \return  the return code for the operation
  */
-static deque_rc_e d_l_list_rc_to_deque_rc(d_l_list_rc_e rc)
-{
-    deque_rc_e new_rc;
-
-    switch (rc) {
-        case D_L_LIST_RC_OK:
-            new_rc = DEQUE_RC_OK;
-            break;
-        case D_L_LIST_RC_EMPTY:
-            new_rc = DEQUE_RC_EMPTY;
-            break;
-        case D_L_LIST_RC_ELEM_NULL:
-            new_rc = DEQUE_RC_ELEM_NULL;
-            break;
-        case D_L_LIST_RC_ELEM_CB_NULL:
-            new_rc = DEQUE_RC_ELEM_CB_NULL;
-            break;
-        case D_L_LIST_RC_NODE_ALLOC_ERR:
-            new_rc = DEQUE_RC_NODE_ALLOC_ERR;
-            break;
-        default:
-            new_rc = DEQUE_RC_NULL;
+static deque_rc_e deque_map_reserve(deque_s *deque, bool at_front)
+{
+    if (NULL == deque->map) {
+        deque->map = (void ***)malloc(DEQUE_MAP_INIT_LENGTH * sizeof(void **));
+
+        if (NULL == deque->map)
+            return DEQUE_RC_NODE_ALLOC_ERR;
+
+        deque->map_length = DEQUE_MAP_INIT_LENGTH;
+        deque->first_block = deque->map_length / 2;
+
+        return DEQUE_RC_OK;
+    }
+
+    if (at_front ? deque->first_block > 0
+                 : deque->first_block + deque->nblocks < deque->map_length)
+        return DEQUE_RC_OK;
+
+    if (deque->nblocks < deque->map_length / 2) {
+        size_t first_block = (deque->map_length - deque->nblocks) / 2;
+
+        memmove(&deque->map[first_block], &deque->map[deque->first_block],
+                deque->nblocks * sizeof(void **));
+        deque->first_block = first_block;
+
+        return DEQUE_RC_OK;
     }
 
-    return new_rc;
+    size_t map_length = deque->map_length * 2;
+    size_t first_block = (map_length - deque->nblocks) / 2;
+    void ***map = (void ***)malloc(map_length * sizeof(void **));
+
+    if (NULL == map)
+        return DEQUE_RC_NODE_ALLOC_ERR;
+
+    memcpy(&map[first_block], &deque->map[deque->first_block], deque->nblocks * sizeof(void **));
+    free(deque->map);
+
+    deque->map = map;
+    deque->map_length = map_length;
+    deque->first_block = first_block;
+
+    return DEQUE_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Get the address of the slot where the element at a position of the deque is stored.
+ * \param   deque  the deque the element is stored in
+ * \param   pos    the position of the element, which must be within the blocks of the deque
+ * \return  the address of the slot of the element
+ */
+static void **deque_slot_at(deque_s *deque, size_t pos)
+{
+    size_t offset = deque->front + pos;
+    void **block = deque->map[deque->first_block + offset / DEQUE_BLOCK_LENGTH];
+
+    return &block[offset % DEQUE_BLOCK_LENGTH];
 }
 
 /* ************************************************************************************************/
 
 void deque_init(deque_s *deque)
 {
-    d_l_list_init(deque);
+    if (NULL != deque) {
+        deque->map = NULL;
+        deque->map_length = 0;
+        deque->first_block = 0;
+        deque->nblocks = 0;
+        deque->front = 0;
+        deque->count = 0;
+        deque->spare = NULL;
+        deque->pool = NULL;
+    }
 
     return;
 }
@@ -53,21 +180,101 @@ void deque_init(deque_s *deque)
 
 deque_s *deque_new(void)
 {
-    return d_l_list_new();
+    deque_s *new_deque = (deque_s *)malloc(sizeof(*new_deque));
+
+    deque_init(new_deque);
+
+    return new_deque;
+}
+
+/* ************************************************************************************************/
+
+deque_rc_e deque_set_pool(deque_s *deque, node_pool_s *pool)
+{
+    if (NULL == deque)
+        return DEQUE_RC_NULL;
+
+    if (deque->count > 0)
+        return DEQUE_RC_NOT_EMPTY;
+
+    if (NULL != pool && pool->node_size < DEQUE_BLOCK_LENGTH * sizeof(void *))
+        return DEQUE_RC_INVALID_POOL;
+
+    /* The spare block must go back to where it was allocated from */
+    if (NULL != deque->spare) {
+        deque_block_free(deque, deque->spare);
+        deque->spare = NULL;
+    }
+
+    deque->pool = pool;
+
+    return DEQUE_RC_OK;
 }
 
 /* ************************************************************************************************/
 
 deque_rc_e deque_push_front(deque_s *deque, void *elem)
 {
-    return d_l_list_rc_to_deque_rc(d_l_list_insert_front(deque, elem));
+    if (NULL == deque)
+        return DEQUE_RC_NULL;
+
+    if (NULL == elem)
+        return DEQUE_RC_ELEM_NULL;
+
+    /* The first block is full (or there's none), so a new one is needed before it */
+    if (0 == deque->front) {
+        deque_rc_e rc = deque_map_reserve(deque, true);
+
+        if (DEQUE_RC_OK != rc)
+            return rc;
+
+        void **block = deque_block_alloc(deque);
+
+        if (NULL == block)
+            return DEQUE_RC_NODE_ALLOC_ERR;
+
+        deque->map[--deque->first_block] = block;
+        deque->nblocks++;
+        deque->front = DEQUE_BLOCK_LENGTH;
+    }
+
+    deque->front--;
+    deque->count++;
+    *deque_slot_at(deque, 0) = elem;
+
+    return DEQUE_RC_OK;
 }
 
 /* ************************************************************************************************/
 
 deque_rc_e deque_push_back(deque_s *deque, void *elem)
 {
-    return d_l_list_rc_to_deque_rc(d_l_list_insert_back(deque, elem));
+    if (NULL == deque)
+        return DEQUE_RC_NULL;
+
+    if (NULL == elem)
+        return DEQUE_RC_ELEM_NULL;
+
+    /* The last block is full (or there's none), so a new one is needed after it */
+    if (deque->front + deque->count == deque->nblocks * DEQUE_BLOCK_LENGTH) {
+        deque_rc_e rc = deque_map_reserve(deque, false);
+
+        if (DEQUE_RC_OK != rc)
+            return rc;
+
+        void **block = deque_block_alloc(deque);
+
+        if (NULL == block)
+            return DEQUE_RC_NODE_ALLOC_ERR;
+
+        deque->map[deque->first_block + deque->nblocks] = block;
+        deque->nblocks++;
+    }
+
+    *deque_slot_at(deque, deque->count) = elem;
+    deque->count++;
+
+    return DEQUE_RC_OK;
 }
 
 /* ************************************************************************************************/
@@ -84,53 +291,131 @@ size_t deque_count(deque_s *deque)
 
 deque_rc_e deque_traverse(deque_s *deque, void (*elem_visit)(void *))
 {
-    return d_l_list_rc_to_deque_rc(d_l_list_traverse_forward(deque, elem_visit));
+    if (NULL == deque)
+        return DEQUE_RC_NULL;
+
+    if (0 == deque->count)
+        return DEQUE_RC_EMPTY;
+
+    if (NULL == elem_visit)
+        return DEQUE_RC_ELEM_CB_NULL;
+
+    for (size_t i = 0; i < deque->count; i++)
+        elem_visit(*deque_slot_at(deque, i));
+
+    return DEQUE_RC_OK;
 }
 
 /* ************************************************************************************************/
 
 void *deque_pick_front(deque_s *deque)
 {
-    if (NULL == deque || NULL == deque->front)
+    return deque_pick_at(deque, 0);
+}
+
+/* ************************************************************************************************/
+
+void *deque_pick_back(deque_s *deque)
+{
+    if (NULL == deque || 0 == deque->count)
         return NULL;
 
-    return deque->front->elem;
+    return *deque_slot_at(deque, deque->count - 1);
 }
 
 /* ************************************************************************************************/
 
-void *deque_pick_back(deque_s *deque)
+void *deque_pick_at(deque_s *deque, size_t pos)
 {
-    if (NULL == deque || NULL == deque->front)
+    if (NULL == deque || pos >= deque->count)
         return NULL;
 
-    return deque->front->prev->elem;
+    return *deque_slot_at(deque, pos);
 }
 
 /* ************************************************************************************************/
 
 void *deque_pop_front(deque_s *deque)
 {
-    return d_l_list_remove_front(deque);
+    if (NULL == deque || 0 == deque->count)
+        return NULL;
+
+    void *elem = *deque_slot_at(deque, 0);
+
+    deque->front++;
+    deque->count--;
+
+    if (0 == deque->count) {
+        deque_blocks_release(deque);
+    } else if (DEQUE_BLOCK_LENGTH == deque->front) {
+        /* The first block has been emptied */
+        deque_block_release(deque, deque->map[deque->first_block++]);
+        deque->nblocks--;
+        deque->front = 0;
+    }
+
+    return elem;
 }
 
 /* ************************************************************************************************/
 
 void *deque_pop_back(deque_s *deque)
 {
-    return d_l_list_remove_back(deque);
+    if (NULL == deque || 0 == deque->count)
+        return NULL;
+
+    deque->count--;
+
+    void *elem = *deque_slot_at(deque, deque->count);
+
+    if (0 == deque->count) {
+        deque_blocks_release(deque);
+    } else if (0 == (deque->front + deque->count) % DEQUE_BLOCK_LENGTH) {
+        /* The last block has been emptied */
+        deque->nblocks--;
+        deque_block_release(deque, deque->map[deque->first_block + deque->nblocks]);
+    }
+
+    return elem;
 }
 
 /* ************************************************************************************************/
 
 deque_rc_e deque_clear(deque_s *deque, void (*elem_destroy)(void **))
 {
-    return d_l_list_rc_to_deque_rc(d_l_list_clear(deque, elem_destroy));
+    if (NULL == deque)
+        return DEQUE_RC_NULL;
+
+    if (0 == deque->count)
+        return DEQUE_RC_EMPTY;
+
+    deque_rc_e rc = (NULL == elem_destroy ? DEQUE_RC_ELEM_CB_NULL : DEQUE_RC_OK);
+
+    if (NULL != elem_destroy) {
+        for (size_t i = 0; i < deque->count; i++)
+            elem_destroy(deque_slot_at(deque, i));
+    }
+
+    deque_blocks_release(deque);
+
+    return rc;
 }
 
 /* ************************************************************************************************/
 
 deque_rc_e deque_destroy(deque_s **deque, void (*elem_destroy)(void **))
 {
-    return d_l_list_rc_to_deque_rc(d_l_list_destroy(deque, elem_destroy));
+    if (NULL == deque || NULL == *deque)
+        return DEQUE_RC_NULL;
+
+    deque_rc_e rc = deque_clear(*deque, elem_destroy);
+
+    if (NULL != (*deque)->spare)
+        deque_block_free(*deque, (*deque)->spare);
+
+    free((*deque)->map);
+    free(*deque);
+    *deque = NULL;
+
+    return rc;
 }
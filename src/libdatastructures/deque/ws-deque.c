@@ -0,0 +1,241 @@
+/**
+ * \file   ws-deque.c
+ * \brief  Lock-free work-stealing deque (Chase-Lev deque) - functions definitions
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include "libdatastructures/deque/ws-deque.h"
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Allocate an array for the deque, copying the elements of the current one (if any).
+ * \param   prev    the current array of the deque, or null
+ * \param   length  the length of the new array (a power of two, not shorter than the current one)
+ * \param   top     the index of the top element of the deque
+ * \param   bottom  the index after the bottom element of the deque
+ * \return  the new array, or null if its allocation has failed
+ */
+static ws_deque_array_s *ws_deque_array_new(ws_deque_array_s *prev, size_t length, ptrdiff_t top,
+                                            ptrdiff_t bottom)
+{
+    ws_deque_array_s *array = (ws_deque_array_s *)malloc(sizeof(*array) +
+                                                         length * sizeof(array->elems[0]));
+
+    if (NULL == array)
+        return NULL;
+
+    array->length = length;
+    array->prev = prev;
+
+    for (ptrdiff_t i = top; NULL != prev && i < bottom; i++) {
+        void *elem = atomic_load_explicit(&prev->elems[(size_t)i & (prev->length - 1)],
+                                          memory_order_relaxed);
+
+        atomic_store_explicit(&array->elems[(size_t)i & (length - 1)], elem,
+                              memory_order_relaxed);
+    }
+
+    return array;
+}
+
+/* ************************************************************************************************/
+
+void ws_deque_init(ws_deque_s *deque, size_t capacity)
+{
+    if (NULL == deque)
+        return;
+
+    size_t length = 2;
+    size_t max_length = (SIZE_MAX - sizeof(ws_deque_array_s)) / sizeof(_Atomic(void *));
+
+    while (length < capacity && length <= max_length / 2)
+        length *= 2;
+
+    atomic_init(&deque->top, 0);
+    atomic_init(&deque->bottom, 0);
+
+    /* A capacity whose array can't even be sized is handled as a failed allocation */
+    atomic_init(&deque->array, length < capacity ? NULL : ws_deque_array_new(NULL, length, 0, 0));
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+ws_deque_s *ws_deque_new(size_t capacity)
+{
+    ws_deque_s *new_deque = (ws_deque_s *)malloc(sizeof(*new_deque));
+
+    ws_deque_init(new_deque, capacity);
+
+    return new_deque;
+}
+
+/* ************************************************************************************************/
+
+ws_deque_rc_e ws_deque_push_bottom(ws_deque_s *deque, void *elem)
+{
+    if (NULL == deque)
+        return WS_DEQUE_RC_NULL;
+
+    if (NULL == elem)
+        return WS_DEQUE_RC_ELEM_NULL;
+
+    ptrdiff_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    ptrdiff_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    ws_deque_array_s *array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+
+    /* The array is full (or there's none), so it's replaced by a longer one */
+    if (NULL == array || (size_t)(bottom - top) >= array->length) {
+        ws_deque_array_s *new_array = ws_deque_array_new(array,
+                                                         NULL != array ? array->length * 2 : 2,
+                                                         top, bottom);
+
+        if (NULL == new_array)
+            return WS_DEQUE_RC_NODE_ALLOC_ERR;
+
+        atomic_store_explicit(&deque->array, new_array, memory_order_release);
+        array = new_array;
+    }
+
+    atomic_store_explicit(&array->elems[(size_t)bottom & (array->length - 1)], elem,
+                          memory_order_relaxed);
+
+    /* The element must be visible to the thieves before the new bottom index */
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+
+    return WS_DEQUE_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+void *ws_deque_pop_bottom(ws_deque_s *deque)
+{
+    if (NULL == deque)
+        return NULL;
+
+    ptrdiff_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    ws_deque_array_s *array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+
+    /* Reserve the bottom element before reading the top index, so a thief stealing it
+       concurrently sees the reservation (or the owner sees the steal) */
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    ptrdiff_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+    void *elem = NULL;
+
+    if (top <= bottom) {
+        elem = atomic_load_explicit(&array->elems[(size_t)bottom & (array->length - 1)],
+                                    memory_order_relaxed);
+
+        /* It's the last element, so the owner races against the thieves for it */
+        if (top == bottom) {
+            if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                         memory_order_seq_cst,
+                                                         memory_order_relaxed))
+                elem = NULL;
+
+            atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        }
+    } else {
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+
+    return elem;
+}
+
+/* ************************************************************************************************/
+
+ws_deque_rc_e ws_deque_steal_top(ws_deque_s *deque, void **elem)
+{
+    if (NULL == deque)
+        return WS_DEQUE_RC_NULL;
+
+    if (NULL == elem)
+        return WS_DEQUE_RC_ELEM_NULL;
+
+    *elem = NULL;
+
+    ptrdiff_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+
+    atomic_thread_fence(memory_order_seq_cst);
+
+    ptrdiff_t bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+    if (top >= bottom)
+        return WS_DEQUE_RC_EMPTY;
+
+    ws_deque_array_s *array = atomic_load_explicit(&deque->array, memory_order_acquire);
+    void *tmp = atomic_load_explicit(&array->elems[(size_t)top & (array->length - 1)],
+                                     memory_order_relaxed);
+
+    if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed))
+        return WS_DEQUE_RC_ABORT;
+
+    *elem = tmp;
+
+    return WS_DEQUE_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+size_t ws_deque_count(ws_deque_s *deque)
+{
+    if (NULL == deque)
+        return 0;
+
+    ptrdiff_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+    ptrdiff_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+
+    /* The owner may have reserved the bottom element of an empty deque meanwhile */
+    return top < bottom ? (size_t)(bottom - top) : 0;
+}
+
+/* ************************************************************************************************/
+
+ws_deque_rc_e ws_deque_clear(ws_deque_s *deque, void (*elem_destroy)(void **))
+{
+    if (NULL == deque)
+        return WS_DEQUE_RC_NULL;
+
+    if (0 == ws_deque_count(deque))
+        return WS_DEQUE_RC_EMPTY;
+
+    ws_deque_rc_e rc = (NULL == elem_destroy ? WS_DEQUE_RC_ELEM_CB_NULL : WS_DEQUE_RC_OK);
+    void *elem;
+
+    while (NULL != (elem = ws_deque_pop_bottom(deque))) {
+        if (NULL != elem_destroy)
+            elem_destroy(&elem);
+    }
+
+    return rc;
+}
+
+/* ************************************************************************************************/
+
+ws_deque_rc_e ws_deque_destroy(ws_deque_s **deque, void (*elem_destroy)(void **))
+{
+    if (NULL == deque || NULL == *deque)
+        return WS_DEQUE_RC_NULL;
+
+    ws_deque_rc_e rc = ws_deque_clear(*deque, elem_destroy);
+    ws_deque_array_s *array = atomic_load_explicit(&(*deque)->array, memory_order_relaxed);
+
+    /* The retired arrays are only deallocated now, as no thief may be reading them anymore */
+    while (NULL != array) {
+        ws_deque_array_s *prev = array->prev;
+
+        free(array);
+        array = prev;
+    }
+
+    free(*deque);
+    *deque = NULL;
+
+    return rc;
+}
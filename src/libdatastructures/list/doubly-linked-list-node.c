@@ -9,7 +9,15 @@
 
 d_l_list_node_s *d_l_list_node_new(void *elem)
 {
-    d_l_list_node_s *new_node = (d_l_list_node_s *)malloc(sizeof(*new_node));
+    return d_l_list_node_new_pooled(elem, NULL);
+}
+
+/* ************************************************************************************************/
+
+d_l_list_node_s *d_l_list_node_new_pooled(void *elem, node_pool_s *pool)
+{
+    d_l_list_node_s *new_node =
+        (d_l_list_node_s *)(NULL != pool ? node_pool_alloc(pool) : malloc(sizeof(*new_node)));
 
     if (NULL != new_node) {
         new_node->elem = elem;
@@ -25,13 +33,24 @@ d_l_list_node_s *d_l_list_node_new(void *elem)
 /* ************************************************************************************************/
 
 void *d_l_list_node_destroy(d_l_list_node_s **node)
+{
+    return d_l_list_node_destroy_pooled(node, NULL);
+}
+
+/* ************************************************************************************************/
+
+void *d_l_list_node_destroy_pooled(d_l_list_node_s **node, node_pool_s *pool)
 {
     if (NULL == node || NULL == *node)
         return NULL;
 
     void *elem = (*node)->elem;
 
-    free(*node);
+    if (NULL != pool)
+        node_pool_free(pool, *node);
+    else
+        free(*node);
+
     *node = NULL;
 
     return elem;
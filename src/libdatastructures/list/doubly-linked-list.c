@@ -2,17 +2,107 @@
  * \file   doubly-linked-list.c
  * \brief  Circ. doubly linked list - functions definitions
  */
+#include <limits.h>
 #include <stdlib.h>
 #include "libdatastructures/list/doubly-linked-list.h"
 #include "libdatastructures/list/doubly-linked-list-node.h"
 
 /* ************************************************************************************************/
 
+/**
+ * \brief   Allocate a node for an element and link it before a node of a non-empty list (or as the
+ *          single node of an empty one). The front of the list isn't updated.
+ * \param   list  the list the node is to be linked onto
+ * \param   next  the node the new one is to be linked before, ignored if the list is empty
+ * \param   elem  the element to be stored on the node
+ * \return  the return code for the insert operation
+ */
+static d_l_list_rc_e d_l_list_link_before(d_l_list_s *list, d_l_list_node_s *next, void *elem)
+{
+    d_l_list_node_s *new_node = d_l_list_node_new_pooled(elem, list->pool);
+
+    if (NULL == new_node)
+        return D_L_LIST_RC_NODE_ALLOC_ERR;
+
+    if (NULL != list->front) {
+        new_node->prev = next->prev;
+        new_node->next = next;
+        next->prev->next = new_node;
+        next->prev = new_node;
+    } else {
+        list->front = new_node;
+    }
+
+    list->count++;
+
+    return D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Merge two sorted, null-terminated chains of nodes (linked by their 'next' pointers only)
+ *          into a single one, taking the nodes of the first chain first on 'equal' elements.
+ * \param   a             the first chain
+ * \param   b             the second chain
+ * \param   elem_compare  pointer to a callback function used to compare two elements
+ * \return  the merged chain
+ */
+static d_l_list_node_s *d_l_list_merge_chains(d_l_list_node_s *a, d_l_list_node_s *b,
+                                              int (*elem_compare)(void *, void *))
+{
+    d_l_list_node_s *head = NULL;
+    d_l_list_node_s **tail = &head;
+
+    while (NULL != a && NULL != b) {
+        if (elem_compare(a->elem, b->elem) >= 0) {
+            *tail = a;
+            a = a->next;
+        } else {
+            *tail = b;
+            b = b->next;
+        }
+
+        tail = &(*tail)->next;
+    }
+
+    *tail = (NULL != a ? a : b);
+
+    return head;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Make a null-terminated chain of nodes the content of a list again, restoring the 'prev'
+ *         pointers of its nodes and linking its ends to each other.
+ * \param  list   the list whose content is the chain
+ * \param  chain  the non-empty chain
+ */
+static void d_l_list_close_chain(d_l_list_s *list, d_l_list_node_s *chain)
+{
+    d_l_list_node_s *tmp = chain;
+
+    while (NULL != tmp->next) {
+        tmp->next->prev = tmp;
+        tmp = tmp->next;
+    }
+
+    tmp->next = chain;
+    chain->prev = tmp;
+    list->front = chain;
+
+    return;
+}
+
+/* ************************************************************************************************/
+
 void d_l_list_init(d_l_list_s *list)
 {
     if (NULL != list) {
         list->front = NULL;
         list->count = 0;
+        list->pool = NULL;
     }
 
     return;
@@ -31,6 +121,24 @@ d_l_list_s *d_l_list_new(void)
 
 /* ************************************************************************************************/
 
+d_l_list_rc_e d_l_list_set_pool(d_l_list_s *list, node_pool_s *pool)
+{
+    if (NULL == list)
+        return D_L_LIST_RC_NULL;
+
+    if (list->count > 0)
+        return D_L_LIST_RC_NOT_EMPTY;
+
+    if (NULL != pool && pool->node_size < sizeof(d_l_list_node_s))
+        return D_L_LIST_RC_INVALID_POOL;
+
+    list->pool = pool;
+
+    return D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
 d_l_list_rc_e d_l_list_insert_front(d_l_list_s *list, void *elem)
 {
     if (NULL == list)
@@ -40,7 +148,7 @@ d_l_list_rc_e d_l_list_insert_front(d_l_list_s *list, void *elem)
     if (NULL == elem)
         return D_L_LIST_RC_ELEM_NULL;
 
-    d_l_list_node_s *new_node = d_l_list_node_new(elem);
+    d_l_list_node_s *new_node = d_l_list_node_new_pooled(elem, list->pool);
 
     if (NULL == new_node)
         return D_L_LIST_RC_NODE_ALLOC_ERR;
@@ -69,7 +177,7 @@ d_l_list_rc_e d_l_list_insert_back(d_l_list_s *list, void *elem)
     if (NULL == elem)
         return D_L_LIST_RC_ELEM_NULL;
 
-    d_l_list_node_s *new_node = d_l_list_node_new(elem);
+    d_l_list_node_s *new_node = d_l_list_node_new_pooled(elem, list->pool);
 
     if (NULL == new_node)
         return D_L_LIST_RC_NODE_ALLOC_ERR;
@@ -90,6 +198,235 @@ d_l_list_rc_e d_l_list_insert_back(d_l_list_s *list, void *elem)
 
 /* ************************************************************************************************/
 
+d_l_list_rc_e d_l_list_concat(d_l_list_s *dst, d_l_list_s *src)
+{
+    if (NULL == dst || NULL == src)
+        return D_L_LIST_RC_NULL;
+
+    if (dst->pool != src->pool)
+        return D_L_LIST_RC_POOL_MISMATCH;
+
+    if (dst == src || NULL == src->front)
+        return D_L_LIST_RC_OK;
+
+    if (NULL != dst->front) {
+        d_l_list_node_s *src_back = src->front->prev;
+
+        dst->front->prev->next = src->front;
+        src->front->prev = dst->front->prev;
+        src_back->next = dst->front;
+        dst->front->prev = src_back;
+    } else {
+        dst->front = src->front;
+    }
+
+    dst->count += src->count;
+    src->front = NULL;
+    src->count = 0;
+
+    return D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+d_l_list_rc_e d_l_list_splice(d_l_list_s *dst, d_l_list_node_s *pos, d_l_list_s *src,
+                              d_l_list_node_s *first, d_l_list_node_s *last)
+{
+    if (NULL == dst || NULL == src)
+        return D_L_LIST_RC_NULL;
+
+    if (dst->pool != src->pool)
+        return D_L_LIST_RC_POOL_MISMATCH;
+
+    if (NULL == src->front)
+        return D_L_LIST_RC_EMPTY;
+
+    if (NULL == first || NULL == last)
+        return D_L_LIST_RC_OUT_OF_RANGE;
+
+    /* Count the nodes of the range, which must end before wrapping around to the front of 'src' */
+    d_l_list_node_s *tmp = first;
+    size_t count = 1;
+
+    while (tmp != last) {
+        if (tmp == pos)
+            return D_L_LIST_RC_OUT_OF_RANGE;
+
+        tmp = tmp->next;
+        count++;
+
+        if (tmp == src->front)
+            return D_L_LIST_RC_OUT_OF_RANGE;
+    }
+
+    if (last == pos)
+        return D_L_LIST_RC_OUT_OF_RANGE;
+
+    /* Unlink the range from 'src'... */
+    if (count == src->count) {
+        src->front = NULL;
+    } else {
+        first->prev->next = last->next;
+        last->next->prev = first->prev;
+
+        if (src->front == first)
+            src->front = last->next;
+    }
+
+    src->count -= count;
+
+    /* ...then link it before 'pos' (or before the front, i.e. at the back) in 'dst' */
+    if (NULL != dst->front) {
+        d_l_list_node_s *next = (NULL != pos ? pos : dst->front);
+
+        first->prev = next->prev;
+        last->next = next;
+        next->prev->next = first;
+        next->prev = last;
+
+        if (dst->front == pos)
+            dst->front = first;
+    } else {
+        first->prev = last;
+        last->next = first;
+        dst->front = first;
+    }
+
+    dst->count += count;
+
+    return D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+d_l_list_rc_e d_l_list_split_at(d_l_list_s *list, size_t pos, d_l_list_s *out)
+{
+    if (NULL == list || NULL == out)
+        return D_L_LIST_RC_NULL;
+
+    if (pos > list->count)
+        return D_L_LIST_RC_OUT_OF_RANGE;
+
+    if (out->count > 0)
+        return D_L_LIST_RC_NOT_EMPTY;
+
+    if (list->pool != out->pool)
+        return D_L_LIST_RC_POOL_MISMATCH;
+
+    if (pos == list->count)
+        return D_L_LIST_RC_OK;
+
+    d_l_list_node_s *node = list->front;
+
+    if (pos <= list->count / 2) {
+        for (size_t i = 0; i < pos; i++)
+            node = node->next;
+    } else {
+        for (size_t i = list->count; i > pos; i--)
+            node = node->prev;
+    }
+
+    if (node != list->front) {
+        d_l_list_node_s *back = list->front->prev;
+
+        node->prev->next = list->front;
+        list->front->prev = node->prev;
+        node->prev = back;
+        back->next = node;
+    } else {
+        list->front = NULL;
+    }
+
+    out->front = node;
+    out->count = list->count - pos;
+    list->count = pos;
+
+    return D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+d_l_list_rc_e d_l_list_sort(d_l_list_s *list, int (*elem_compare)(void *, void *))
+{
+    if (NULL == list)
+        return D_L_LIST_RC_NULL;
+
+    if (NULL == list->front && 0 == list->count)
+        return D_L_LIST_RC_EMPTY;
+
+    if (NULL == elem_compare)
+        return D_L_LIST_RC_ELEM_CB_NULL;
+
+    /* Every bin is either empty or stores a sorted chain of 2^i nodes, older than those of the
+     * lower bins, so merging a bin with the lower ones as the second chain keeps the sort stable */
+    d_l_list_node_s *bins[sizeof(size_t) * CHAR_BIT] = { NULL };
+    size_t nbins = 0;
+
+    d_l_list_node_s *chain = list->front;
+    list->front->prev->next = NULL;
+
+    while (NULL != chain) {
+        d_l_list_node_s *carry = chain;
+        chain = chain->next;
+        carry->next = NULL;
+
+        size_t i = 0;
+
+        for (; i < nbins && NULL != bins[i]; i++) {
+            carry = d_l_list_merge_chains(bins[i], carry, elem_compare);
+            bins[i] = NULL;
+        }
+
+        bins[i] = carry;
+
+        if (i == nbins)
+            nbins++;
+    }
+
+    for (size_t i = 0; i < nbins; i++) {
+        if (NULL != bins[i])
+            chain = d_l_list_merge_chains(bins[i], chain, elem_compare);
+    }
+
+    d_l_list_close_chain(list, chain);
+
+    return D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+d_l_list_rc_e d_l_list_merge(d_l_list_s *dst, d_l_list_s *src,
+                             int (*elem_compare)(void *, void *))
+{
+    if (NULL == dst || NULL == src)
+        return D_L_LIST_RC_NULL;
+
+    if (NULL == elem_compare)
+        return D_L_LIST_RC_ELEM_CB_NULL;
+
+    if (dst->pool != src->pool)
+        return D_L_LIST_RC_POOL_MISMATCH;
+
+    if (dst == src || NULL == src->front)
+        return D_L_LIST_RC_OK;
+
+    if (NULL == dst->front)
+        return d_l_list_concat(dst, src);
+
+    dst->front->prev->next = NULL;
+    src->front->prev->next = NULL;
+
+    d_l_list_close_chain(dst, d_l_list_merge_chains(dst->front, src->front, elem_compare));
+
+    dst->count += src->count;
+    src->front = NULL;
+    src->count = 0;
+
+    return D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
 d_l_list_rc_e d_l_list_traverse_forward(d_l_list_s *list, void (*elem_visit)(void *))
 {
     if (NULL == list)
@@ -136,6 +473,205 @@ d_l_list_rc_e d_l_list_traverse_backward(d_l_list_s *list, void (*elem_visit)(vo
 
 /* ************************************************************************************************/
 
+void *d_l_list_find(d_l_list_s *list, void *elem, int (*elem_compare)(void *, void *))
+{
+    if (NULL == list || NULL == list->front || NULL == elem_compare)
+        return NULL;
+
+    d_l_list_node_s *tmp = list->front;
+
+    do {
+        if (0 == elem_compare(elem, tmp->elem))
+            return tmp->elem;
+
+        tmp = tmp->next;
+    } while (tmp != list->front);
+
+    return NULL;
+}
+
+/* ************************************************************************************************/
+
+d_l_list_rc_e d_l_list_remove_if(d_l_list_s *list, bool (*elem_match)(void *),
+                                 void (*elem_destroy)(void **))
+{
+    if (NULL == list)
+        return D_L_LIST_RC_NULL;
+
+    if (NULL == list->front && 0 == list->count)
+        return D_L_LIST_RC_EMPTY;
+
+    if (NULL == elem_match)
+        return D_L_LIST_RC_ELEM_CB_NULL;
+
+    d_l_list_rc_e rc = (NULL == elem_destroy ? D_L_LIST_RC_ELEM_CB_NULL : D_L_LIST_RC_OK);
+
+    d_l_list_node_s *tmp = list->front;
+
+    for (size_t n = list->count; n > 0; n--) {
+        d_l_list_node_s *node = tmp;
+        tmp = tmp->next;
+
+        if (!elem_match(node->elem))
+            continue;
+
+        if (node == node->next) {
+            list->front = NULL;
+        } else {
+            node->prev->next = node->next;
+            node->next->prev = node->prev;
+
+            if (list->front == node)
+                list->front = node->next;
+        }
+
+        list->count--;
+
+        void *elem = d_l_list_node_destroy_pooled(&node, list->pool);
+
+        if (NULL != elem_destroy)
+            elem_destroy(&elem);
+    }
+
+    return rc;
+}
+
+/* ************************************************************************************************/
+
+d_l_list_rc_e d_l_list_cursor_begin(d_l_list_cursor_s *cursor, d_l_list_s *list)
+{
+    if (NULL == cursor || NULL == list)
+        return D_L_LIST_RC_NULL;
+
+    cursor->list = list;
+    cursor->curr = list->front;
+
+    return (NULL == list->front ? D_L_LIST_RC_EMPTY : D_L_LIST_RC_OK);
+}
+
+/* ************************************************************************************************/
+
+d_l_list_rc_e d_l_list_cursor_end(d_l_list_cursor_s *cursor, d_l_list_s *list)
+{
+    if (NULL == cursor || NULL == list)
+        return D_L_LIST_RC_NULL;
+
+    cursor->list = list;
+    cursor->curr = NULL;
+
+    return (NULL == list->front ? D_L_LIST_RC_EMPTY : D_L_LIST_RC_OK);
+}
+
+/* ************************************************************************************************/
+
+d_l_list_rc_e d_l_list_cursor_next(d_l_list_cursor_s *cursor)
+{
+    if (NULL == cursor || NULL == cursor->list)
+        return D_L_LIST_RC_NULL;
+
+    if (NULL == cursor->curr)
+        return D_L_LIST_RC_OUT_OF_RANGE;
+
+    cursor->curr = (cursor->curr->next != cursor->list->front ? cursor->curr->next : NULL);
+
+    return D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+d_l_list_rc_e d_l_list_cursor_prev(d_l_list_cursor_s *cursor)
+{
+    if (NULL == cursor || NULL == cursor->list)
+        return D_L_LIST_RC_NULL;
+
+    if (NULL == cursor->list->front)
+        return D_L_LIST_RC_EMPTY;
+
+    if (cursor->curr == cursor->list->front)
+        return D_L_LIST_RC_OUT_OF_RANGE;
+
+    cursor->curr = (NULL != cursor->curr ? cursor->curr : cursor->list->front)->prev;
+
+    return D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+void *d_l_list_cursor_get(d_l_list_cursor_s *cursor)
+{
+    if (NULL == cursor || NULL == cursor->curr)
+        return NULL;
+
+    return cursor->curr->elem;
+}
+
+/* ************************************************************************************************/
+
+void *d_l_list_cursor_remove_current(d_l_list_cursor_s *cursor)
+{
+    if (NULL == cursor || NULL == cursor->list || NULL == cursor->curr)
+        return NULL;
+
+    d_l_list_s *list = cursor->list;
+    d_l_list_node_s *node = cursor->curr;
+    d_l_list_node_s *next = (node->next != list->front ? node->next : NULL);
+
+    if (node == node->next) {
+        list->front = NULL;
+    } else {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+
+        if (list->front == node)
+            list->front = node->next;
+    }
+
+    list->count--;
+    cursor->curr = next;
+
+    return d_l_list_node_destroy_pooled(&node, list->pool);
+}
+
+/* ************************************************************************************************/
+
+d_l_list_rc_e d_l_list_cursor_insert_before(d_l_list_cursor_s *cursor, void *elem)
+{
+    if (NULL == cursor || NULL == cursor->list)
+        return D_L_LIST_RC_NULL;
+
+    /* Don't allow insertion of null elements */
+    if (NULL == elem)
+        return D_L_LIST_RC_ELEM_NULL;
+
+    d_l_list_s *list = cursor->list;
+    d_l_list_rc_e rc =
+        d_l_list_link_before(list, NULL != cursor->curr ? cursor->curr : list->front, elem);
+
+    if (D_L_LIST_RC_OK == rc && list->front == cursor->curr)
+        list->front = cursor->curr->prev;
+
+    return rc;
+}
+
+/* ************************************************************************************************/
+
+d_l_list_rc_e d_l_list_cursor_insert_after(d_l_list_cursor_s *cursor, void *elem)
+{
+    if (NULL == cursor || NULL == cursor->list)
+        return D_L_LIST_RC_NULL;
+
+    /* Don't allow insertion of null elements */
+    if (NULL == elem)
+        return D_L_LIST_RC_ELEM_NULL;
+
+    if (NULL == cursor->curr)
+        return D_L_LIST_RC_OUT_OF_RANGE;
+
+    return d_l_list_link_before(cursor->list, cursor->curr->next, elem);
+}
+
+/* ************************************************************************************************/
+
 void *d_l_list_remove_front(d_l_list_s *list)
 {
     if (NULL == list || NULL == list->front)
@@ -156,12 +692,12 @@ void *d_l_list_remove_back(d_l_list_s *list)
     void *elem;
 
     if (list->front == list->front->next && list->front == list->front->prev) {
-        elem = d_l_list_node_destroy(&list->front);
+        elem = d_l_list_node_destroy_pooled(&list->front, list->pool);
     } else {
         d_l_list_node_s *tmp = list->front->prev;
         tmp->prev->next = tmp->next;
         tmp->next->prev = tmp->prev;
-        elem = d_l_list_node_destroy(&tmp);
+        elem = d_l_list_node_destroy_pooled(&tmp, list->pool);
     }
 
     list->count--;
@@ -190,7 +726,7 @@ d_l_list_rc_e d_l_list_clear(d_l_list_s *list, void (*elem_destroy)(void **))
 
     while (NULL != list->front) {
         tmp = list->front->next;
-        elem = d_l_list_node_destroy(&list->front);
+        elem = d_l_list_node_destroy_pooled(&list->front, list->pool);
 
         if (NULL != elem_destroy)
             elem_destroy(&elem);
@@ -0,0 +1,290 @@
+/**
+ * \file   intrusive-doubly-linked-list.c
+ * \brief  Circ. intrusive doubly linked list - functions definitions
+ */
+#include <stdlib.h>
+#include "libdatastructures/list/intrusive-doubly-linked-list.h"
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Link an element before the front element of a non-empty list, or as its single element.
+ * \param  list  the list the element is to be linked onto
+ * \param  link  the link of the element
+ */
+static void i_d_l_list_link_before_front(i_d_l_list_s *list, d_l_list_link_s *link)
+{
+    if (NULL != list->front) {
+        link->prev = list->front->prev;
+        link->next = list->front;
+        list->front->prev->next = link;
+        list->front->prev = link;
+    } else {
+        link->prev = link;
+        link->next = link;
+        list->front = link;
+    }
+
+    list->count++;
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+void d_l_list_link_init(d_l_list_link_s *link)
+{
+    if (NULL != link) {
+        link->prev = NULL;
+        link->next = NULL;
+    }
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+bool d_l_list_link_is_linked(d_l_list_link_s *link)
+{
+    return NULL != link && NULL != link->next;
+}
+
+/* ************************************************************************************************/
+
+void i_d_l_list_init(i_d_l_list_s *list)
+{
+    if (NULL != list) {
+        list->front = NULL;
+        list->count = 0;
+    }
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+i_d_l_list_s *i_d_l_list_new(void)
+{
+    i_d_l_list_s *new_list = (i_d_l_list_s *)malloc(sizeof(*new_list));
+
+    i_d_l_list_init(new_list);
+
+    return new_list;
+}
+
+/* ************************************************************************************************/
+
+i_d_l_list_rc_e i_d_l_list_insert_front(i_d_l_list_s *list, d_l_list_link_s *link)
+{
+    if (NULL == list)
+        return I_D_L_LIST_RC_NULL;
+
+    if (NULL == link)
+        return I_D_L_LIST_RC_ELEM_NULL;
+
+    if (d_l_list_link_is_linked(link))
+        return I_D_L_LIST_RC_ELEM_LINKED;
+
+    i_d_l_list_link_before_front(list, link);
+    list->front = link;
+
+    return I_D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+i_d_l_list_rc_e i_d_l_list_insert_back(i_d_l_list_s *list, d_l_list_link_s *link)
+{
+    if (NULL == list)
+        return I_D_L_LIST_RC_NULL;
+
+    if (NULL == link)
+        return I_D_L_LIST_RC_ELEM_NULL;
+
+    if (d_l_list_link_is_linked(link))
+        return I_D_L_LIST_RC_ELEM_LINKED;
+
+    i_d_l_list_link_before_front(list, link);
+
+    return I_D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+size_t i_d_l_list_count(i_d_l_list_s *list)
+{
+    if (NULL == list)
+        return 0;
+
+    return list->count;
+}
+
+/* ************************************************************************************************/
+
+d_l_list_link_s *i_d_l_list_front(i_d_l_list_s *list)
+{
+    if (NULL == list)
+        return NULL;
+
+    return list->front;
+}
+
+/* ************************************************************************************************/
+
+d_l_list_link_s *i_d_l_list_back(i_d_l_list_s *list)
+{
+    if (NULL == list || NULL == list->front)
+        return NULL;
+
+    return list->front->prev;
+}
+
+/* ************************************************************************************************/
+
+i_d_l_list_rc_e i_d_l_list_traverse_forward(i_d_l_list_s *list,
+                                            void (*link_visit)(d_l_list_link_s *))
+{
+    if (NULL == list)
+        return I_D_L_LIST_RC_NULL;
+
+    if (NULL == list->front && 0 == list->count)
+        return I_D_L_LIST_RC_EMPTY;
+
+    if (NULL == link_visit)
+        return I_D_L_LIST_RC_ELEM_CB_NULL;
+
+    d_l_list_link_s *tmp = list->front;
+
+    do {
+        link_visit(tmp);
+        tmp = tmp->next;
+    } while (tmp != list->front);
+
+    return I_D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+i_d_l_list_rc_e i_d_l_list_traverse_backward(i_d_l_list_s *list,
+                                             void (*link_visit)(d_l_list_link_s *))
+{
+    if (NULL == list)
+        return I_D_L_LIST_RC_NULL;
+
+    if (NULL == list->front && 0 == list->count)
+        return I_D_L_LIST_RC_EMPTY;
+
+    if (NULL == link_visit)
+        return I_D_L_LIST_RC_ELEM_CB_NULL;
+
+    d_l_list_link_s *tmp = list->front->prev;
+
+    do {
+        link_visit(tmp);
+        tmp = tmp->prev;
+    } while (tmp != list->front->prev);
+
+    return I_D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+i_d_l_list_rc_e i_d_l_list_remove(i_d_l_list_s *list, d_l_list_link_s *link)
+{
+    if (NULL == list)
+        return I_D_L_LIST_RC_NULL;
+
+    if (NULL == link)
+        return I_D_L_LIST_RC_ELEM_NULL;
+
+    if (!d_l_list_link_is_linked(link))
+        return I_D_L_LIST_RC_ELEM_NOT_LINKED;
+
+    if (0 == list->count)
+        return I_D_L_LIST_RC_EMPTY;
+
+    if (link->next == link) {
+        list->front = NULL;
+    } else {
+        link->prev->next = link->next;
+        link->next->prev = link->prev;
+
+        if (list->front == link)
+            list->front = link->next;
+    }
+
+    d_l_list_link_init(link);
+    list->count--;
+
+    return I_D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+d_l_list_link_s *i_d_l_list_remove_front(i_d_l_list_s *list)
+{
+    d_l_list_link_s *link = i_d_l_list_front(list);
+
+    if (I_D_L_LIST_RC_OK != i_d_l_list_remove(list, link))
+        return NULL;
+
+    return link;
+}
+
+/* ************************************************************************************************/
+
+d_l_list_link_s *i_d_l_list_remove_back(i_d_l_list_s *list)
+{
+    d_l_list_link_s *link = i_d_l_list_back(list);
+
+    if (I_D_L_LIST_RC_OK != i_d_l_list_remove(list, link))
+        return NULL;
+
+    return link;
+}
+
+/* ************************************************************************************************/
+
+i_d_l_list_rc_e i_d_l_list_clear(i_d_l_list_s *list, void (*link_destroy)(d_l_list_link_s *))
+{
+    if (NULL == list)
+        return I_D_L_LIST_RC_NULL;
+
+    if (NULL == list->front && 0 == list->count)
+        return I_D_L_LIST_RC_EMPTY;
+
+    i_d_l_list_rc_e rc = (NULL == link_destroy ? I_D_L_LIST_RC_ELEM_CB_NULL : I_D_L_LIST_RC_OK);
+
+    /* Firstly, make the circular list a non-circular one */
+    list->front->prev->next = NULL;
+
+    while (NULL != list->front) {
+        d_l_list_link_s *tmp = list->front;
+        list->front = tmp->next;
+
+        /* The link is unmarked before its callback, which may deallocate the element */
+        d_l_list_link_init(tmp);
+
+        if (NULL != link_destroy)
+            link_destroy(tmp);
+    }
+
+    list->count = 0;
+
+    return rc;
+}
+
+/* ************************************************************************************************/
+
+i_d_l_list_rc_e i_d_l_list_destroy(i_d_l_list_s **list, void (*link_destroy)(d_l_list_link_s *))
+{
+    if (NULL == list || NULL == *list)
+        return I_D_L_LIST_RC_NULL;
+
+    i_d_l_list_rc_e rc = i_d_l_list_clear(*list, link_destroy);
+
+    free(*list);
+    *list = NULL;
+
+    return rc;
+}
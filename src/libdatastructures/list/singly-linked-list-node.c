@@ -9,7 +9,15 @@
 
 s_l_list_node_s *s_l_list_node_new(void *elem)
 {
-    s_l_list_node_s *new_node = (s_l_list_node_s *)malloc(sizeof(*new_node));
+    return s_l_list_node_new_pooled(elem, NULL);
+}
+
+/* ************************************************************************************************/
+
+s_l_list_node_s *s_l_list_node_new_pooled(void *elem, node_pool_s *pool)
+{
+    s_l_list_node_s *new_node =
+        (s_l_list_node_s *)(NULL != pool ? node_pool_alloc(pool) : malloc(sizeof(*new_node)));
 
     if (NULL != new_node) {
         new_node->elem = elem;
@@ -24,13 +32,24 @@ s_l_list_node_s *s_l_list_node_new(void *elem)
 /* ************************************************************************************************/
 
 void *s_l_list_node_destroy(s_l_list_node_s **node)
+{
+    return s_l_list_node_destroy_pooled(node, NULL);
+}
+
+/* ************************************************************************************************/
+
+void *s_l_list_node_destroy_pooled(s_l_list_node_s **node, node_pool_s *pool)
 {
     if (NULL == node || NULL == *node)
         return NULL;
 
     void *elem = (*node)->elem;
 
-    free(*node);
+    if (NULL != pool)
+        node_pool_free(pool, *node);
+    else
+        free(*node);
+
     *node = NULL;
 
     return elem;
@@ -2,17 +2,52 @@
  * \file   singly-linked-list.c
  * \brief  Circ. singly linked list - functions definitions
  */
+#include <limits.h>
 #include <stdlib.h>
 #include "libdatastructures/list/singly-linked-list.h"
 #include "libdatastructures/list/singly-linked-list-node.h"
 
 /* ************************************************************************************************/
 
+/**
+ * \brief   Merge two sorted, null-terminated chains of nodes into a single one, taking the nodes of
+ *          the first chain first on 'equal' elements.
+ * \param   a             the first chain
+ * \param   b             the second chain
+ * \param   elem_compare  pointer to a callback function used to compare two elements
+ * \return  the merged chain
+ */
+static s_l_list_node_s *s_l_list_merge_chains(s_l_list_node_s *a, s_l_list_node_s *b,
+                                              int (*elem_compare)(void *, void *))
+{
+    s_l_list_node_s *head = NULL;
+    s_l_list_node_s **tail = &head;
+
+    while (NULL != a && NULL != b) {
+        if (elem_compare(a->elem, b->elem) >= 0) {
+            *tail = a;
+            a = a->next;
+        } else {
+            *tail = b;
+            b = b->next;
+        }
+
+        tail = &(*tail)->next;
+    }
+
+    *tail = (NULL != a ? a : b);
+
+    return head;
+}
+
+/* ************************************************************************************************/
+
 void s_l_list_init(s_l_list_s *list)
 {
     if (NULL != list) {
         list->back = NULL;
         list->count = 0;
+        list->pool = NULL;
     }
 
     return;
@@ -31,6 +66,24 @@ s_l_list_s *s_l_list_new(void)
 
 /* ************************************************************************************************/
 
+s_l_list_rc_e s_l_list_set_pool(s_l_list_s *list, node_pool_s *pool)
+{
+    if (NULL == list)
+        return S_L_LIST_RC_NULL;
+
+    if (list->count > 0)
+        return S_L_LIST_RC_NOT_EMPTY;
+
+    if (NULL != pool && pool->node_size < sizeof(s_l_list_node_s))
+        return S_L_LIST_RC_INVALID_POOL;
+
+    list->pool = pool;
+
+    return S_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
 s_l_list_rc_e s_l_list_insert_front(s_l_list_s *list, void *elem)
 {
     if (NULL == list)
@@ -40,7 +93,7 @@ s_l_list_rc_e s_l_list_insert_front(s_l_list_s *list, void *elem)
     if (NULL == elem)
         return S_L_LIST_RC_ELEM_NULL;
 
-    s_l_list_node_s *new_node = s_l_list_node_new(elem);
+    s_l_list_node_s *new_node = s_l_list_node_new_pooled(elem, list->pool);
 
     if (NULL == new_node)
         return S_L_LIST_RC_NODE_ALLOC_ERR;
@@ -68,7 +121,7 @@ s_l_list_rc_e s_l_list_insert_back(s_l_list_s *list, void *elem)
     if (NULL == elem)
         return S_L_LIST_RC_ELEM_NULL;
 
-    s_l_list_node_s *new_node = s_l_list_node_new(elem);
+    s_l_list_node_s *new_node = s_l_list_node_new_pooled(elem, list->pool);
 
     if (NULL == new_node)
         return S_L_LIST_RC_NODE_ALLOC_ERR;
@@ -86,6 +139,89 @@ s_l_list_rc_e s_l_list_insert_back(s_l_list_s *list, void *elem)
 
 /* ************************************************************************************************/
 
+s_l_list_rc_e s_l_list_concat(s_l_list_s *dst, s_l_list_s *src)
+{
+    if (NULL == dst || NULL == src)
+        return S_L_LIST_RC_NULL;
+
+    if (dst->pool != src->pool)
+        return S_L_LIST_RC_POOL_MISMATCH;
+
+    if (dst == src || NULL == src->back)
+        return S_L_LIST_RC_OK;
+
+    if (NULL != dst->back) {
+        s_l_list_node_s *front = dst->back->next;
+
+        dst->back->next = src->back->next;
+        src->back->next = front;
+    }
+
+    dst->back = src->back;
+    dst->count += src->count;
+    src->back = NULL;
+    src->count = 0;
+
+    return S_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+s_l_list_rc_e s_l_list_sort(s_l_list_s *list, int (*elem_compare)(void *, void *))
+{
+    if (NULL == list)
+        return S_L_LIST_RC_NULL;
+
+    if (NULL == list->back && 0 == list->count)
+        return S_L_LIST_RC_EMPTY;
+
+    if (NULL == elem_compare)
+        return S_L_LIST_RC_ELEM_CB_NULL;
+
+    /* Every bin is either empty or stores a sorted chain of 2^i nodes, older than those of the
+     * lower bins, so merging a bin with the lower ones as the second chain keeps the sort stable */
+    s_l_list_node_s *bins[sizeof(size_t) * CHAR_BIT] = { NULL };
+    size_t nbins = 0;
+
+    s_l_list_node_s *chain = list->back->next;
+    list->back->next = NULL;
+
+    while (NULL != chain) {
+        s_l_list_node_s *carry = chain;
+        chain = chain->next;
+        carry->next = NULL;
+
+        size_t i = 0;
+
+        for (; i < nbins && NULL != bins[i]; i++) {
+            carry = s_l_list_merge_chains(bins[i], carry, elem_compare);
+            bins[i] = NULL;
+        }
+
+        bins[i] = carry;
+
+        if (i == nbins)
+            nbins++;
+    }
+
+    for (size_t i = 0; i < nbins; i++) {
+        if (NULL != bins[i])
+            chain = s_l_list_merge_chains(bins[i], chain, elem_compare);
+    }
+
+    /* Finally, find the new back node and make the list a circular one again */
+    list->back = chain;
+
+    while (NULL != list->back->next)
+        list->back = list->back->next;
+
+    list->back->next = chain;
+
+    return S_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
 s_l_list_rc_e s_l_list_traverse(s_l_list_s *list, void (*elem_visit)(void *))
 {
     if (NULL == list)
@@ -109,6 +245,221 @@ s_l_list_rc_e s_l_list_traverse(s_l_list_s *list, void (*elem_visit)(void *))
 
 /* ************************************************************************************************/
 
+void *s_l_list_find(s_l_list_s *list, void *elem, int (*elem_compare)(void *, void *))
+{
+    if (NULL == list || NULL == list->back || NULL == elem_compare)
+        return NULL;
+
+    s_l_list_node_s *tmp = list->back->next;
+
+    do {
+        if (0 == elem_compare(elem, tmp->elem))
+            return tmp->elem;
+
+        tmp = tmp->next;
+    } while (tmp != list->back->next);
+
+    return NULL;
+}
+
+/* ************************************************************************************************/
+
+s_l_list_rc_e s_l_list_remove_if(s_l_list_s *list, bool (*elem_match)(void *),
+                                 void (*elem_destroy)(void **))
+{
+    if (NULL == list)
+        return S_L_LIST_RC_NULL;
+
+    if (NULL == list->back && 0 == list->count)
+        return S_L_LIST_RC_EMPTY;
+
+    if (NULL == elem_match)
+        return S_L_LIST_RC_ELEM_CB_NULL;
+
+    s_l_list_rc_e rc = (NULL == elem_destroy ? S_L_LIST_RC_ELEM_CB_NULL : S_L_LIST_RC_OK);
+
+    /* The last kept node (or the back one, until a node is kept) precedes the current one */
+    s_l_list_node_s *prev = list->back;
+    s_l_list_node_s *tmp = list->back->next;
+
+    for (size_t n = list->count; n > 0; n--) {
+        s_l_list_node_s *node = tmp;
+        tmp = tmp->next;
+
+        if (!elem_match(node->elem)) {
+            prev = node;
+            continue;
+        }
+
+        if (node == node->next) {
+            list->back = NULL;
+        } else {
+            prev->next = node->next;
+
+            if (list->back == node)
+                list->back = prev;
+        }
+
+        list->count--;
+
+        void *elem = s_l_list_node_destroy_pooled(&node, list->pool);
+
+        if (NULL != elem_destroy)
+            elem_destroy(&elem);
+    }
+
+    return rc;
+}
+
+/* ************************************************************************************************/
+
+s_l_list_rc_e s_l_list_cursor_begin(s_l_list_cursor_s *cursor, s_l_list_s *list)
+{
+    if (NULL == cursor || NULL == list)
+        return S_L_LIST_RC_NULL;
+
+    cursor->list = list;
+    cursor->prev = list->back;
+    cursor->curr = (NULL != list->back ? list->back->next : NULL);
+
+    return (NULL == list->back ? S_L_LIST_RC_EMPTY : S_L_LIST_RC_OK);
+}
+
+/* ************************************************************************************************/
+
+s_l_list_rc_e s_l_list_cursor_end(s_l_list_cursor_s *cursor, s_l_list_s *list)
+{
+    if (NULL == cursor || NULL == list)
+        return S_L_LIST_RC_NULL;
+
+    cursor->list = list;
+    cursor->prev = list->back;
+    cursor->curr = NULL;
+
+    return (NULL == list->back ? S_L_LIST_RC_EMPTY : S_L_LIST_RC_OK);
+}
+
+/* ************************************************************************************************/
+
+s_l_list_rc_e s_l_list_cursor_next(s_l_list_cursor_s *cursor)
+{
+    if (NULL == cursor || NULL == cursor->list)
+        return S_L_LIST_RC_NULL;
+
+    if (NULL == cursor->curr)
+        return S_L_LIST_RC_OUT_OF_RANGE;
+
+    cursor->prev = cursor->curr;
+    cursor->curr = (cursor->curr != cursor->list->back ? cursor->curr->next : NULL);
+
+    return S_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+void *s_l_list_cursor_get(s_l_list_cursor_s *cursor)
+{
+    if (NULL == cursor || NULL == cursor->curr)
+        return NULL;
+
+    return cursor->curr->elem;
+}
+
+/* ************************************************************************************************/
+
+void *s_l_list_cursor_remove_current(s_l_list_cursor_s *cursor)
+{
+    if (NULL == cursor || NULL == cursor->list || NULL == cursor->curr)
+        return NULL;
+
+    s_l_list_s *list = cursor->list;
+    s_l_list_node_s *node = cursor->curr;
+
+    if (node == node->next) {
+        list->back = NULL;
+        cursor->prev = NULL;
+        cursor->curr = NULL;
+    } else {
+        cursor->prev->next = node->next;
+
+        if (list->back == node) {
+            list->back = cursor->prev;
+            cursor->curr = NULL;
+        } else {
+            cursor->curr = node->next;
+        }
+    }
+
+    list->count--;
+
+    return s_l_list_node_destroy_pooled(&node, list->pool);
+}
+
+/* ************************************************************************************************/
+
+s_l_list_rc_e s_l_list_cursor_insert_before(s_l_list_cursor_s *cursor, void *elem)
+{
+    if (NULL == cursor || NULL == cursor->list)
+        return S_L_LIST_RC_NULL;
+
+    /* Don't allow insertion of null elements */
+    if (NULL == elem)
+        return S_L_LIST_RC_ELEM_NULL;
+
+    s_l_list_s *list = cursor->list;
+    s_l_list_node_s *new_node = s_l_list_node_new_pooled(elem, list->pool);
+
+    if (NULL == new_node)
+        return S_L_LIST_RC_NODE_ALLOC_ERR;
+
+    if (NULL != cursor->prev) {
+        new_node->next = cursor->prev->next;
+        cursor->prev->next = new_node;
+    }
+
+    /* When the cursor is at the end, the new node becomes the back one */
+    if (NULL == cursor->curr)
+        list->back = new_node;
+
+    cursor->prev = new_node;
+    list->count++;
+
+    return S_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+s_l_list_rc_e s_l_list_cursor_insert_after(s_l_list_cursor_s *cursor, void *elem)
+{
+    if (NULL == cursor || NULL == cursor->list)
+        return S_L_LIST_RC_NULL;
+
+    /* Don't allow insertion of null elements */
+    if (NULL == elem)
+        return S_L_LIST_RC_ELEM_NULL;
+
+    if (NULL == cursor->curr)
+        return S_L_LIST_RC_OUT_OF_RANGE;
+
+    s_l_list_s *list = cursor->list;
+    s_l_list_node_s *new_node = s_l_list_node_new_pooled(elem, list->pool);
+
+    if (NULL == new_node)
+        return S_L_LIST_RC_NODE_ALLOC_ERR;
+
+    new_node->next = cursor->curr->next;
+    cursor->curr->next = new_node;
+
+    if (list->back == cursor->curr)
+        list->back = new_node;
+
+    list->count++;
+
+    return S_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
 void *s_l_list_remove_front(s_l_list_s *list)
 {
     if (NULL == list || NULL == list->back)
@@ -117,10 +468,10 @@ void *s_l_list_remove_front(s_l_list_s *list)
     void *elem;
 
     if (list->back == list->back->next) {
-        elem = s_l_list_node_destroy(&list->back);
+        elem = s_l_list_node_destroy_pooled(&list->back, list->pool);
     } else {
         s_l_list_node_s *tmp = list->back->next->next;
-        elem = s_l_list_node_destroy(&list->back->next);
+        elem = s_l_list_node_destroy_pooled(&list->back->next, list->pool);
         list->back->next = tmp;
     }
 
@@ -150,7 +501,7 @@ s_l_list_rc_e s_l_list_clear(s_l_list_s *list, void (*elem_destroy)(void **))
 
     while (NULL != front) {
         tmp = front->next;
-        elem = s_l_list_node_destroy(&front);
+        elem = s_l_list_node_destroy_pooled(&front, list->pool);
 
         if (NULL != elem_destroy)
             elem_destroy(&elem);
@@ -0,0 +1,302 @@
+/**
+ * \file   unrolled-doubly-linked-list.c
+ * \brief  Circ. unrolled doubly linked list - functions definitions
+ */
+#include <stdlib.h>
+#include "libdatastructures/list/unrolled-doubly-linked-list.h"
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Get the slot of the ring of a node where one of its elements is stored.
+ * \param   node  the node to be indexed
+ * \param   pos   the position of the element in the node (it may be one past the last one)
+ * \return  the slot of the ring
+ */
+static size_t u_d_l_list_slot(u_d_l_list_node_s *node, size_t pos)
+{
+    return (node->first + pos) % U_D_L_LIST_NODE_LENGTH;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Allocate a new, empty node and link it before the front node of a list (so it's either
+ *          the new front or the new back node, depending on the caller).
+ * \param   list  the list the node is to be linked onto
+ * \return  pointer to the allocated node, or null if the allocation has failed
+ */
+static u_d_l_list_node_s *u_d_l_list_node_link(u_d_l_list_s *list)
+{
+    u_d_l_list_node_s *new_node = (u_d_l_list_node_s *)malloc(sizeof(*new_node));
+
+    if (NULL == new_node)
+        return NULL;
+
+    new_node->first = 0;
+    new_node->count = 0;
+
+    if (NULL != list->front) {
+        new_node->prev = list->front->prev;
+        new_node->next = list->front;
+        list->front->prev->next = new_node;
+        list->front->prev = new_node;
+    } else {
+        new_node->prev = new_node;
+        new_node->next = new_node;
+        list->front = new_node;
+    }
+
+    return new_node;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Unlink an empty node from a list and deallocate it.
+ * \param  list  the list the node is to be unlinked from
+ * \param  node  the node to be unlinked
+ */
+static void u_d_l_list_node_unlink(u_d_l_list_s *list, u_d_l_list_node_s *node)
+{
+    if (node->next == node) {
+        list->front = NULL;
+    } else {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+
+        if (list->front == node)
+            list->front = node->next;
+    }
+
+    free(node);
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+void u_d_l_list_init(u_d_l_list_s *list)
+{
+    if (NULL != list) {
+        list->front = NULL;
+        list->count = 0;
+    }
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+u_d_l_list_s *u_d_l_list_new(void)
+{
+    u_d_l_list_s *new_list = (u_d_l_list_s *)malloc(sizeof(*new_list));
+
+    u_d_l_list_init(new_list);
+
+    return new_list;
+}
+
+/* ************************************************************************************************/
+
+u_d_l_list_rc_e u_d_l_list_insert_front(u_d_l_list_s *list, void *elem)
+{
+    if (NULL == list)
+        return U_D_L_LIST_RC_NULL;
+
+    /* Don't allow insertion of null elements */
+    if (NULL == elem)
+        return U_D_L_LIST_RC_ELEM_NULL;
+
+    u_d_l_list_node_s *node = list->front;
+
+    if (NULL == node || U_D_L_LIST_NODE_LENGTH == node->count) {
+        node = u_d_l_list_node_link(list);
+
+        if (NULL == node)
+            return U_D_L_LIST_RC_NODE_ALLOC_ERR;
+
+        list->front = node;
+    }
+
+    node->first = u_d_l_list_slot(node, U_D_L_LIST_NODE_LENGTH - 1);
+    node->elems[node->first] = elem;
+    node->count++;
+    list->count++;
+
+    return U_D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+u_d_l_list_rc_e u_d_l_list_insert_back(u_d_l_list_s *list, void *elem)
+{
+    if (NULL == list)
+        return U_D_L_LIST_RC_NULL;
+
+    /* Don't allow insertion of null elements */
+    if (NULL == elem)
+        return U_D_L_LIST_RC_ELEM_NULL;
+
+    u_d_l_list_node_s *node = (NULL != list->front ? list->front->prev : NULL);
+
+    if (NULL == node || U_D_L_LIST_NODE_LENGTH == node->count) {
+        node = u_d_l_list_node_link(list);
+
+        if (NULL == node)
+            return U_D_L_LIST_RC_NODE_ALLOC_ERR;
+    }
+
+    node->elems[u_d_l_list_slot(node, node->count)] = elem;
+    node->count++;
+    list->count++;
+
+    return U_D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+size_t u_d_l_list_count(u_d_l_list_s *list)
+{
+    if (NULL == list)
+        return 0;
+
+    return list->count;
+}
+
+/* ************************************************************************************************/
+
+u_d_l_list_rc_e u_d_l_list_traverse_forward(u_d_l_list_s *list, void (*elem_visit)(void *))
+{
+    if (NULL == list)
+        return U_D_L_LIST_RC_NULL;
+
+    if (NULL == list->front && 0 == list->count)
+        return U_D_L_LIST_RC_EMPTY;
+
+    if (NULL == elem_visit)
+        return U_D_L_LIST_RC_ELEM_CB_NULL;
+
+    u_d_l_list_node_s *tmp = list->front;
+
+    do {
+        for (size_t i = 0; i < tmp->count; i++)
+            elem_visit(tmp->elems[u_d_l_list_slot(tmp, i)]);
+
+        tmp = tmp->next;
+    } while (tmp != list->front);
+
+    return U_D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+u_d_l_list_rc_e u_d_l_list_traverse_backward(u_d_l_list_s *list, void (*elem_visit)(void *))
+{
+    if (NULL == list)
+        return U_D_L_LIST_RC_NULL;
+
+    if (NULL == list->front && 0 == list->count)
+        return U_D_L_LIST_RC_EMPTY;
+
+    if (NULL == elem_visit)
+        return U_D_L_LIST_RC_ELEM_CB_NULL;
+
+    u_d_l_list_node_s *tmp = list->front;
+
+    do {
+        tmp = tmp->prev;
+
+        for (size_t i = tmp->count; i > 0; i--)
+            elem_visit(tmp->elems[u_d_l_list_slot(tmp, i - 1)]);
+    } while (tmp != list->front);
+
+    return U_D_L_LIST_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+void *u_d_l_list_remove_front(u_d_l_list_s *list)
+{
+    if (NULL == list || NULL == list->front)
+        return NULL;
+
+    u_d_l_list_node_s *node = list->front;
+    void *elem = node->elems[node->first];
+
+    node->first = u_d_l_list_slot(node, 1);
+    node->count--;
+    list->count--;
+
+    if (0 == node->count)
+        u_d_l_list_node_unlink(list, node);
+
+    return elem;
+}
+
+/* ************************************************************************************************/
+
+void *u_d_l_list_remove_back(u_d_l_list_s *list)
+{
+    if (NULL == list || NULL == list->front)
+        return NULL;
+
+    u_d_l_list_node_s *node = list->front->prev;
+
+    node->count--;
+    list->count--;
+
+    void *elem = node->elems[u_d_l_list_slot(node, node->count)];
+
+    if (0 == node->count)
+        u_d_l_list_node_unlink(list, node);
+
+    return elem;
+}
+
+/* ************************************************************************************************/
+
+u_d_l_list_rc_e u_d_l_list_clear(u_d_l_list_s *list, void (*elem_destroy)(void **))
+{
+    if (NULL == list)
+        return U_D_L_LIST_RC_NULL;
+
+    if (NULL == list->front && 0 == list->count)
+        return U_D_L_LIST_RC_EMPTY;
+
+    u_d_l_list_rc_e rc = (NULL == elem_destroy ? U_D_L_LIST_RC_ELEM_CB_NULL : U_D_L_LIST_RC_OK);
+
+    /* Firstly, make the circular list a non-circular one */
+    list->front->prev->next = NULL;
+
+    while (NULL != list->front) {
+        u_d_l_list_node_s *tmp = list->front->next;
+
+        for (size_t i = 0; i < list->front->count && NULL != elem_destroy; i++) {
+            void *elem = list->front->elems[u_d_l_list_slot(list->front, i)];
+            elem_destroy(&elem);
+        }
+
+        free(list->front);
+        list->front = tmp;
+    }
+
+    list->count = 0;
+
+    return rc;
+}
+
+/* ************************************************************************************************/
+
+u_d_l_list_rc_e u_d_l_list_destroy(u_d_l_list_s **list, void (*elem_destroy)(void **))
+{
+    if (NULL == list || NULL == *list)
+        return U_D_L_LIST_RC_NULL;
+
+    u_d_l_list_rc_e rc = u_d_l_list_clear(*list, elem_destroy);
+
+    free(*list);
+    *list = NULL;
+
+    return rc;
+}
@@ -0,0 +1,162 @@
+/**
+ * \file   node-pool.c
+ * \brief  Node pool (slab allocator) - functions definitions
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include "libdatastructures/pool/node-pool.h"
+
+/** Header of every slab, which keeps the nodes that follow it suitably aligned */
+union node_pool_slab {
+    /** Pointer to the previously allocated slab */
+    union node_pool_slab *next;
+    /** Unused; it only aligns the header */
+    max_align_t align;
+};
+
+/** The alignment of every node, which suits nodes made of pointers and sizes */
+#define NODE_POOL_ALIGN (sizeof(void *))
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Allocate a new slab for the pool, putting all its nodes on the free list.
+ * \param   pool  the pool the slab is to be allocated for
+ * \return  the return code for the allocation
+ */
+static node_pool_rc_e node_pool_grow(node_pool_s *pool)
+{
+    if (pool->slab_length > (SIZE_MAX - sizeof(union node_pool_slab)) / pool->node_size)
+        return NODE_POOL_RC_SLAB_ALLOC_ERR;
+
+    union node_pool_slab *slab = (union node_pool_slab *)malloc(
+        sizeof(union node_pool_slab) + pool->slab_length * pool->node_size);
+
+    if (NULL == slab)
+        return NODE_POOL_RC_SLAB_ALLOC_ERR;
+
+    slab->next = (union node_pool_slab *)pool->slabs;
+    pool->slabs = slab;
+
+    /* Thread the nodes onto the free list backwards, so they're allocated in address order */
+    unsigned char *nodes = (unsigned char *)(slab + 1);
+
+    for (size_t i = pool->slab_length; i > 0; i--) {
+        void **node = (void **)(nodes + (i - 1) * pool->node_size);
+        *node = pool->free_nodes;
+        pool->free_nodes = node;
+    }
+
+    pool->capacity += pool->slab_length;
+
+    return NODE_POOL_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+void node_pool_init(node_pool_s *pool, size_t node_size, size_t slab_length)
+{
+    if (NULL != pool) {
+        /* Every free node stores the pointer to the next free one */
+        if (node_size < sizeof(void *))
+            node_size = sizeof(void *);
+
+        pool->node_size = (node_size + NODE_POOL_ALIGN - 1) / NODE_POOL_ALIGN * NODE_POOL_ALIGN;
+        pool->slab_length = (0 == slab_length ? NODE_POOL_DEFAULT_SLAB_LENGTH : slab_length);
+        pool->slabs = NULL;
+        pool->free_nodes = NULL;
+        pool->count = 0;
+        pool->capacity = 0;
+    }
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+node_pool_s *node_pool_new(size_t node_size, size_t slab_length)
+{
+    node_pool_s *pool = (node_pool_s *)malloc(sizeof(node_pool_s));
+
+    node_pool_init(pool, node_size, slab_length);
+
+    return pool;
+}
+
+/* ************************************************************************************************/
+
+node_pool_rc_e node_pool_reserve(node_pool_s *pool, size_t nodes)
+{
+    if (NULL == pool)
+        return NODE_POOL_RC_NULL;
+
+    while (pool->capacity - pool->count < nodes) {
+        node_pool_rc_e rc = node_pool_grow(pool);
+
+        if (NODE_POOL_RC_OK != rc)
+            return rc;
+    }
+
+    return NODE_POOL_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+void *node_pool_alloc(node_pool_s *pool)
+{
+    if (NULL == pool)
+        return NULL;
+
+    if (NULL == pool->free_nodes && NODE_POOL_RC_OK != node_pool_grow(pool))
+        return NULL;
+
+    void **node = (void **)pool->free_nodes;
+    pool->free_nodes = *node;
+    pool->count++;
+
+    return node;
+}
+
+/* ************************************************************************************************/
+
+void node_pool_free(node_pool_s *pool, void *node)
+{
+    if (NULL != pool && NULL != node) {
+        *(void **)node = pool->free_nodes;
+        pool->free_nodes = node;
+        pool->count--;
+    }
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+size_t node_pool_count(node_pool_s *pool)
+{
+    if (NULL == pool)
+        return 0;
+
+    return pool->count;
+}
+
+/* ************************************************************************************************/
+
+node_pool_rc_e node_pool_destroy(node_pool_s **pool)
+{
+    if (NULL == pool || NULL == *pool)
+        return NODE_POOL_RC_NULL;
+
+    union node_pool_slab *slab = (union node_pool_slab *)(*pool)->slabs;
+
+    while (NULL != slab) {
+        union node_pool_slab *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+
+    free(*pool);
+    *pool = NULL;
+
+    return NODE_POOL_RC_OK;
+}
@@ -0,0 +1,279 @@
+/**
+ * \file   blocking-queue.c
+ * \brief  Blocking bounded queue - functions definitions
+ */
+#include <errno.h>
+#include <stdlib.h>
+#include <time.h>
+#include "libdatastructures/queue/blocking-queue.h"
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Convert a queue return code to a blocking queue one
+ * \param   rc  the queue operation return code
+ * \return  an equivalent blocking queue operation return code
+ */
+static blocking_queue_rc_e queue_rc_to_blocking_queue_rc(queue_rc_e rc)
+{
+    blocking_queue_rc_e new_rc;
+
+    switch (rc) {
+        case QUEUE_RC_OK:
+            new_rc = BLOCKING_QUEUE_RC_OK;
+            break;
+        case QUEUE_RC_EMPTY:
+            new_rc = BLOCKING_QUEUE_RC_EMPTY;
+            break;
+        case QUEUE_RC_ELEM_NULL:
+            new_rc = BLOCKING_QUEUE_RC_ELEM_NULL;
+            break;
+        case QUEUE_RC_ELEM_CB_NULL:
+            new_rc = BLOCKING_QUEUE_RC_ELEM_CB_NULL;
+            break;
+        case QUEUE_RC_NODE_ALLOC_ERR:
+            new_rc = BLOCKING_QUEUE_RC_NODE_ALLOC_ERR;
+            break;
+        default:
+            new_rc = BLOCKING_QUEUE_RC_NULL;
+    }
+
+    return new_rc;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Compute the (monotonic clock) time when a timeout expires.
+ * \param  deadline    where the time is to be stored
+ * \param  timeout_ms  the timeout, in milliseconds (positive)
+ */
+static void blocking_queue_deadline(struct timespec *deadline, long timeout_ms)
+{
+    clock_gettime(CLOCK_MONOTONIC, deadline);
+
+    deadline->tv_sec += timeout_ms / 1000;
+    deadline->tv_nsec += (timeout_ms % 1000) * 1000000L;
+
+    if (deadline->tv_nsec >= 1000000000L) {
+        deadline->tv_sec++;
+        deadline->tv_nsec -= 1000000000L;
+    }
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Wait on a condition variable of the queue, with its lock held.
+ * \param   queue       the queue to be waited on
+ * \param   cond        the condition variable to be waited on
+ * \param   timeout_ms  the timeout (zero not to wait at all, or 'BLOCKING_QUEUE_WAIT_FOREVER')
+ * \param   deadline    the time when the timeout expires, if it's positive
+ * \return  false if the timeout has expired, true otherwise (the condition may still not hold)
+ */
+static bool blocking_queue_wait(blocking_queue_s *queue, pthread_cond_t *cond, long timeout_ms,
+                                const struct timespec *deadline)
+{
+    if (0 == timeout_ms)
+        return false;
+
+    if (timeout_ms < 0) {
+        pthread_cond_wait(cond, &queue->lock);
+        return true;
+    }
+
+    return ETIMEDOUT != pthread_cond_timedwait(cond, &queue->lock, deadline);
+}
+
+/* ************************************************************************************************/
+
+void blocking_queue_init(blocking_queue_s *queue, size_t capacity)
+{
+    if (NULL == queue)
+        return;
+
+    pthread_condattr_t attr;
+
+    queue_init(&queue->queue);
+    queue->capacity = capacity;
+    queue->closed = false;
+    pthread_mutex_init(&queue->lock, NULL);
+
+    /* The timed waits are measured against the monotonic clock */
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&queue->not_empty, &attr);
+    pthread_cond_init(&queue->not_full, &attr);
+    pthread_condattr_destroy(&attr);
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+blocking_queue_s *blocking_queue_new(size_t capacity)
+{
+    blocking_queue_s *new_queue = (blocking_queue_s *)malloc(sizeof(*new_queue));
+
+    blocking_queue_init(new_queue, capacity);
+
+    return new_queue;
+}
+
+/* ************************************************************************************************/
+
+blocking_queue_rc_e blocking_queue_enqueue(blocking_queue_s *queue, void *elem, long timeout_ms)
+{
+    if (NULL == queue)
+        return BLOCKING_QUEUE_RC_NULL;
+
+    if (NULL == elem)
+        return BLOCKING_QUEUE_RC_ELEM_NULL;
+
+    struct timespec deadline;
+    blocking_queue_rc_e rc = BLOCKING_QUEUE_RC_OK;
+
+    if (timeout_ms > 0)
+        blocking_queue_deadline(&deadline, timeout_ms);
+
+    pthread_mutex_lock(&queue->lock);
+
+    while (!queue->closed && 0 < queue->capacity &&
+           queue_count(&queue->queue) >= queue->capacity) {
+        if (!blocking_queue_wait(queue, &queue->not_full, timeout_ms, &deadline)) {
+            rc = (0 == timeout_ms ? BLOCKING_QUEUE_RC_FULL : BLOCKING_QUEUE_RC_TIMEOUT);
+            break;
+        }
+    }
+
+    if (queue->closed) {
+        rc = BLOCKING_QUEUE_RC_CLOSED;
+    } else if (BLOCKING_QUEUE_RC_OK == rc) {
+        rc = queue_rc_to_blocking_queue_rc(queue_enqueue(&queue->queue, elem));
+
+        if (BLOCKING_QUEUE_RC_OK == rc)
+            pthread_cond_signal(&queue->not_empty);
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+
+    return rc;
+}
+
+/* ************************************************************************************************/
+
+void *blocking_queue_dequeue(blocking_queue_s *queue, long timeout_ms)
+{
+    void *elem = NULL;
+
+    blocking_queue_dequeue_batch(queue, &elem, 1, timeout_ms);
+
+    return elem;
+}
+
+/* ************************************************************************************************/
+
+size_t blocking_queue_dequeue_batch(blocking_queue_s *queue, void **elems, size_t max,
+                                    long timeout_ms)
+{
+    if (NULL == queue || NULL == elems || 0 == max)
+        return 0;
+
+    struct timespec deadline;
+
+    if (timeout_ms > 0)
+        blocking_queue_deadline(&deadline, timeout_ms);
+
+    pthread_mutex_lock(&queue->lock);
+
+    while (!queue->closed && 0 == queue_count(&queue->queue)) {
+        if (!blocking_queue_wait(queue, &queue->not_empty, timeout_ms, &deadline))
+            break;
+    }
+
+    size_t n = queue_dequeue_batch(&queue->queue, elems, max);
+
+    /* Every dequeued element makes room for a waiting producer */
+    if (1 == n)
+        pthread_cond_signal(&queue->not_full);
+    else if (n > 1)
+        pthread_cond_broadcast(&queue->not_full);
+
+    pthread_mutex_unlock(&queue->lock);
+
+    return n;
+}
+
+/* ************************************************************************************************/
+
+size_t blocking_queue_count(blocking_queue_s *queue)
+{
+    if (NULL == queue)
+        return 0;
+
+    pthread_mutex_lock(&queue->lock);
+
+    size_t count = queue_count(&queue->queue);
+
+    pthread_mutex_unlock(&queue->lock);
+
+    return count;
+}
+
+/* ************************************************************************************************/
+
+blocking_queue_rc_e blocking_queue_close(blocking_queue_s *queue)
+{
+    if (NULL == queue)
+        return BLOCKING_QUEUE_RC_NULL;
+
+    pthread_mutex_lock(&queue->lock);
+
+    queue->closed = true;
+    pthread_cond_broadcast(&queue->not_empty);
+    pthread_cond_broadcast(&queue->not_full);
+
+    pthread_mutex_unlock(&queue->lock);
+
+    return BLOCKING_QUEUE_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+blocking_queue_rc_e blocking_queue_clear(blocking_queue_s *queue, void (*elem_destroy)(void **))
+{
+    if (NULL == queue)
+        return BLOCKING_QUEUE_RC_NULL;
+
+    pthread_mutex_lock(&queue->lock);
+
+    blocking_queue_rc_e rc = queue_rc_to_blocking_queue_rc(queue_clear(&queue->queue,
+                                                                       elem_destroy));
+
+    pthread_cond_broadcast(&queue->not_full);
+
+    pthread_mutex_unlock(&queue->lock);
+
+    return rc;
+}
+
+/* ************************************************************************************************/
+
+blocking_queue_rc_e blocking_queue_destroy(blocking_queue_s **queue,
+                                           void (*elem_destroy)(void **))
+{
+    if (NULL == queue || NULL == *queue)
+        return BLOCKING_QUEUE_RC_NULL;
+
+    blocking_queue_rc_e rc = blocking_queue_clear(*queue, elem_destroy);
+
+    pthread_cond_destroy(&(*queue)->not_full);
+    pthread_cond_destroy(&(*queue)->not_empty);
+    pthread_mutex_destroy(&(*queue)->lock);
+    free(*queue);
+    *queue = NULL;
+
+    return rc;
+}
@@ -0,0 +1,195 @@
+/**
+ * \file   mpmc-queue.c
+ * \brief  Lock-free bounded multi-producer/multi-consumer queue - functions definitions
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include "libdatastructures/queue/mpmc-queue.h"
+
+/* ************************************************************************************************/
+
+void mpmc_queue_init(mpmc_queue_s *queue, size_t capacity)
+{
+    if (NULL == queue)
+        return;
+
+    size_t length = 2;
+    size_t max_length = SIZE_MAX / sizeof(*queue->cells);
+
+    while (length < capacity && length <= max_length / 2)
+        length *= 2;
+
+    /* A capacity whose cells can't even be sized is handled as a failed allocation */
+    queue->cells = (length < capacity ? NULL :
+                    (mpmc_queue_cell_s *)malloc(length * sizeof(*queue->cells)));
+    queue->mask = 0;
+
+    if (NULL != queue->cells) {
+        /* A cell is ready to be enqueued into when its sequence number equals the position */
+        for (size_t i = 0; i < length; i++) {
+            atomic_init(&queue->cells[i].seq, i);
+            queue->cells[i].elem = NULL;
+        }
+
+        queue->mask = length - 1;
+    }
+
+    atomic_init(&queue->enqueue_pos, 0);
+    atomic_init(&queue->dequeue_pos, 0);
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+mpmc_queue_s *mpmc_queue_new(size_t capacity)
+{
+    mpmc_queue_s *new_queue = (mpmc_queue_s *)malloc(sizeof(*new_queue));
+
+    mpmc_queue_init(new_queue, capacity);
+
+    return new_queue;
+}
+
+/* ************************************************************************************************/
+
+mpmc_queue_rc_e mpmc_queue_enqueue(mpmc_queue_s *queue, void *elem)
+{
+    if (NULL == queue)
+        return MPMC_QUEUE_RC_NULL;
+
+    if (NULL == elem)
+        return MPMC_QUEUE_RC_ELEM_NULL;
+
+    if (NULL == queue->cells)
+        return MPMC_QUEUE_RC_FULL;
+
+    mpmc_queue_cell_s *cell;
+    size_t pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+
+    for (;;) {
+        cell = &queue->cells[pos & queue->mask];
+
+        size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)(seq - pos);
+
+        if (0 == diff) {
+            /* The cell is free: claim the position (or retry with the one another thread left) */
+            if (atomic_compare_exchange_weak_explicit(&queue->enqueue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            /* The cell still holds the element enqueued a lap ago */
+            return MPMC_QUEUE_RC_FULL;
+        } else {
+            pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+        }
+    }
+
+    cell->elem = elem;
+    atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+
+    return MPMC_QUEUE_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+void *mpmc_queue_try_dequeue(mpmc_queue_s *queue)
+{
+    if (NULL == queue || NULL == queue->cells)
+        return NULL;
+
+    mpmc_queue_cell_s *cell;
+    size_t pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+
+    for (;;) {
+        cell = &queue->cells[pos & queue->mask];
+
+        size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)(seq - (pos + 1));
+
+        if (0 == diff) {
+            /* The cell is filled: claim the position (or retry with the one another thread left) */
+            if (atomic_compare_exchange_weak_explicit(&queue->dequeue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            /* The cell hasn't been enqueued into yet */
+            return NULL;
+        } else {
+            pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+        }
+    }
+
+    void *elem = cell->elem;
+
+    /* Make the cell ready to be enqueued into on the next lap */
+    atomic_store_explicit(&cell->seq, pos + queue->mask + 1, memory_order_release);
+
+    return elem;
+}
+
+/* ************************************************************************************************/
+
+size_t mpmc_queue_count(mpmc_queue_s *queue)
+{
+    if (NULL == queue)
+        return 0;
+
+    size_t dequeue_pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+    size_t enqueue_pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+    size_t count = enqueue_pos - dequeue_pos;
+
+    /* The positions are read at different times, so the difference may be out of bounds */
+    if (count > mpmc_queue_capacity(queue))
+        return enqueue_pos < dequeue_pos ? 0 : mpmc_queue_capacity(queue);
+
+    return count;
+}
+
+/* ************************************************************************************************/
+
+size_t mpmc_queue_capacity(mpmc_queue_s *queue)
+{
+    if (NULL == queue || NULL == queue->cells)
+        return 0;
+
+    return queue->mask + 1;
+}
+
+/* ************************************************************************************************/
+
+mpmc_queue_rc_e mpmc_queue_clear(mpmc_queue_s *queue, void (*elem_destroy)(void **))
+{
+    if (NULL == queue)
+        return MPMC_QUEUE_RC_NULL;
+
+    if (0 == mpmc_queue_count(queue))
+        return MPMC_QUEUE_RC_EMPTY;
+
+    mpmc_queue_rc_e rc = (NULL == elem_destroy ? MPMC_QUEUE_RC_ELEM_CB_NULL : MPMC_QUEUE_RC_OK);
+    void *elem;
+
+    while (NULL != (elem = mpmc_queue_try_dequeue(queue))) {
+        if (NULL != elem_destroy)
+            elem_destroy(&elem);
+    }
+
+    return rc;
+}
+
+/* ************************************************************************************************/
+
+mpmc_queue_rc_e mpmc_queue_destroy(mpmc_queue_s **queue, void (*elem_destroy)(void **))
+{
+    if (NULL == queue || NULL == *queue)
+        return MPMC_QUEUE_RC_NULL;
+
+    mpmc_queue_rc_e rc = mpmc_queue_clear(*queue, elem_destroy);
+
+    free((*queue)->cells);
+    free(*queue);
+    *queue = NULL;
+
+    return rc;
+}
@@ -0,0 +1,322 @@
+/**
+ * \file   priority-queue.c
+ * \brief  Priority queue (d-ary heap) data structure - functions definitions
+ */
+#include <stdbool.h>
+#include <stdlib.h>
+#include "libdatastructures/array/array.h"
+#include "libdatastructures/queue/priority-queue.h"
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Convert an array return code to a priority queue one
+ * \param   rc  the array operation return code
+ * \return  an equivalent priority queue operation return code
+ */
+static pq_rc_e array_rc_to_pq_rc(array_rc_e rc)
+{
+    pq_rc_e new_rc;
+
+    switch (rc) {
+        case ARRAY_RC_OK:
+            new_rc = PQ_RC_OK;
+            break;
+        case ARRAY_RC_EMPTY:
+            new_rc = PQ_RC_EMPTY;
+            break;
+        case ARRAY_RC_ELEM_NULL:
+            new_rc = PQ_RC_ELEM_NULL;
+            break;
+        case ARRAY_RC_ELEM_CB_NULL:
+            new_rc = PQ_RC_ELEM_CB_NULL;
+            break;
+        case ARRAY_RC_NODE_ALLOC_ERR:
+            new_rc = PQ_RC_NODE_ALLOC_ERR;
+            break;
+        default:
+            new_rc = PQ_RC_NULL;
+    }
+
+    return new_rc;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Tell whether an element is to be popped before another one.
+ * \param   pq  the priority queue the elements are in
+ * \param   e1  the first element
+ * \param   e2  the second element
+ * \return  true if the first element is lesser than the second one, false otherwise
+ */
+static bool pq_elem_before(pq_s *pq, void *e1, void *e2)
+{
+    return pq->elem_compare(e1, e2) > 0;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Store an element at an index of the heap, telling it its index.
+ * \param  pq    the priority queue the element is in
+ * \param  elem  the element
+ * \param  idx   the index of the heap where the element is to be stored
+ */
+static void pq_elem_place(pq_s *pq, void *elem, size_t idx)
+{
+    /* The heap is only pushed and popped at its back, so its front is always the first slot */
+    pq->array.elems[idx] = elem;
+
+    if (NULL != pq->elem_index)
+        pq->elem_index(elem, idx);
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Move an element up the heap, while it's lesser than its parent.
+ * \param  pq   the priority queue the element is in
+ * \param  idx  the index of the element
+ */
+static void pq_sift_up(pq_s *pq, size_t idx)
+{
+    void *elem = pq->array.elems[idx];
+
+    while (idx > 0) {
+        size_t parent = (idx - 1) / pq->arity;
+
+        if (!pq_elem_before(pq, elem, pq->array.elems[parent]))
+            break;
+
+        pq_elem_place(pq, pq->array.elems[parent], idx);
+        idx = parent;
+    }
+
+    pq_elem_place(pq, elem, idx);
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Move an element down the heap, while its least child is lesser than it.
+ * \param  pq   the priority queue the element is in
+ * \param  idx  the index of the element
+ */
+static void pq_sift_down(pq_s *pq, size_t idx)
+{
+    size_t count = pq->array.count;
+    void *elem = pq->array.elems[idx];
+
+    /* An element has children as long as 'arity * idx + 1 < count' */
+    while (count >= 2 && idx <= (count - 2) / pq->arity) {
+        size_t first = pq->arity * idx + 1;
+        size_t last = (count - first > pq->arity ? first + pq->arity : count);
+        size_t least = first;
+
+        for (size_t child = first + 1; child < last; child++) {
+            if (pq_elem_before(pq, pq->array.elems[child], pq->array.elems[least]))
+                least = child;
+        }
+
+        if (!pq_elem_before(pq, pq->array.elems[least], elem))
+            break;
+
+        pq_elem_place(pq, pq->array.elems[least], idx);
+        idx = least;
+    }
+
+    pq_elem_place(pq, elem, idx);
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+void pq_init(pq_s *pq, size_t arity, int (*elem_compare)(void *, void *))
+{
+    if (NULL != pq) {
+        array_init_growable(&pq->array, 0);
+        pq->arity = (arity < 2 ? 2 : arity);
+        pq->elem_compare = elem_compare;
+        pq->elem_index = NULL;
+    }
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+pq_s *pq_new(size_t arity, int (*elem_compare)(void *, void *))
+{
+    pq_s *new_pq = (pq_s *)malloc(sizeof(*new_pq));
+
+    pq_init(new_pq, arity, elem_compare);
+
+    return new_pq;
+}
+
+/* ************************************************************************************************/
+
+pq_rc_e pq_set_elem_index(pq_s *pq, void (*elem_index)(void *, size_t))
+{
+    if (NULL == pq)
+        return PQ_RC_NULL;
+
+    pq->elem_index = elem_index;
+
+    for (size_t i = 0; NULL != elem_index && i < pq->array.count; i++)
+        elem_index(pq->array.elems[i], i);
+
+    return PQ_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+pq_rc_e pq_push(pq_s *pq, void *elem)
+{
+    if (NULL == pq)
+        return PQ_RC_NULL;
+
+    if (NULL == elem)
+        return PQ_RC_ELEM_NULL;
+
+    if (NULL == pq->elem_compare)
+        return PQ_RC_ELEM_CB_NULL;
+
+    pq_rc_e rc = array_rc_to_pq_rc(array_push_back(&pq->array, elem));
+
+    if (PQ_RC_OK == rc)
+        pq_sift_up(pq, pq->array.count - 1);
+
+    return rc;
+}
+
+/* ************************************************************************************************/
+
+pq_rc_e pq_heapify(pq_s *pq, void **elems, size_t n)
+{
+    if (NULL == pq)
+        return PQ_RC_NULL;
+
+    if (NULL == pq->elem_compare)
+        return PQ_RC_ELEM_CB_NULL;
+
+    if (0 == n)
+        return PQ_RC_OK;
+
+    if (NULL == elems)
+        return PQ_RC_ELEM_NULL;
+
+    for (size_t i = 0; i < n; i++) {
+        if (NULL == elems[i])
+            return PQ_RC_ELEM_NULL;
+    }
+
+    pq_rc_e rc = array_rc_to_pq_rc(array_reserve(&pq->array, pq->array.count + n));
+
+    if (PQ_RC_OK != rc)
+        return rc;
+
+    size_t old_count = pq->array.count;
+
+    for (size_t i = 0; i < n; i++) {
+        array_push_back(&pq->array, elems[i]);
+        pq_elem_place(pq, elems[i], old_count + i);
+    }
+
+    /* Floyd's method: sift down every element which has children, from the last one up */
+    if (pq->array.count >= 2) {
+        for (size_t i = (pq->array.count - 2) / pq->arity + 1; i > 0; i--)
+            pq_sift_down(pq, i - 1);
+    }
+
+    return PQ_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+size_t pq_count(pq_s *pq)
+{
+    if (NULL == pq)
+        return 0;
+
+    return pq->array.count;
+}
+
+/* ************************************************************************************************/
+
+void *pq_peek(pq_s *pq)
+{
+    if (NULL == pq || 0 == pq->array.count)
+        return NULL;
+
+    return pq->array.elems[0];
+}
+
+/* ************************************************************************************************/
+
+void *pq_pop_min(pq_s *pq)
+{
+    if (NULL == pq || 0 == pq->array.count)
+        return NULL;
+
+    void *min = pq->array.elems[0];
+    void *last = array_pop_back(&pq->array);
+
+    /* The last element fills the root in, and then it's moved down to its place */
+    if (pq->array.count > 0) {
+        pq->array.elems[0] = last;
+        pq_sift_down(pq, 0);
+    }
+
+    return min;
+}
+
+/* ************************************************************************************************/
+
+pq_rc_e pq_decrease_key(pq_s *pq, size_t idx)
+{
+    if (NULL == pq)
+        return PQ_RC_NULL;
+
+    if (0 == pq->array.count)
+        return PQ_RC_EMPTY;
+
+    if (idx >= pq->array.count)
+        return PQ_RC_OUT_OF_RANGE;
+
+    pq_sift_up(pq, idx);
+
+    return PQ_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+pq_rc_e pq_clear(pq_s *pq, void (*elem_destroy)(void **))
+{
+    if (NULL == pq)
+        return PQ_RC_NULL;
+
+    return array_rc_to_pq_rc(array_clear(&pq->array, elem_destroy));
+}
+
+/* ************************************************************************************************/
+
+pq_rc_e pq_destroy(pq_s **pq, void (*elem_destroy)(void **))
+{
+    if (NULL == pq || NULL == *pq)
+        return PQ_RC_NULL;
+
+    pq_rc_e rc = pq_clear(*pq, elem_destroy);
+
+    array_shrink_to_fit(&(*pq)->array);
+    free(*pq);
+    *pq = NULL;
+
+    return rc;
+}
@@ -33,6 +33,12 @@ static queue_rc_e s_l_list_rc_to_queue_rc(s_l_list_rc_e rc)
         case S_L_LIST_RC_NODE_ALLOC_ERR:
             new_rc = QUEUE_RC_NODE_ALLOC_ERR;
             break;
+        case S_L_LIST_RC_NOT_EMPTY:
+            new_rc = QUEUE_RC_NOT_EMPTY;
+            break;
+        case S_L_LIST_RC_INVALID_POOL:
+            new_rc = QUEUE_RC_INVALID_POOL;
+            break;
         default:
             new_rc = QUEUE_RC_NULL;
     }
@@ -58,6 +64,13 @@ queue_s *queue_new(void)
 
 /* ************************************************************************************************/
 
+queue_rc_e queue_set_pool(queue_s *queue, node_pool_s *pool)
+{
+    return s_l_list_rc_to_queue_rc(s_l_list_set_pool(queue, pool));
+}
+
+/* ************************************************************************************************/
+
 queue_rc_e queue_enqueue(queue_s *queue, void *elem)
 {
     return s_l_list_rc_to_queue_rc(s_l_list_insert_back(queue, elem));
@@ -99,6 +112,29 @@ void *queue_dequeue(queue_s *queue)
 
 /* ************************************************************************************************/
 
+size_t queue_dequeue_batch(queue_s *queue, void **elems, size_t max)
+{
+    if (NULL == queue || NULL == elems)
+        return 0;
+
+    size_t n = 0;
+
+    while (n < max && NULL != queue->back)
+        elems[n++] = s_l_list_remove_front(queue);
+
+    return n;
+}
+
+/* ************************************************************************************************/
+
+queue_rc_e queue_remove_if(queue_s *queue, bool (*elem_match)(void *),
+                           void (*elem_destroy)(void **))
+{
+    return s_l_list_rc_to_queue_rc(s_l_list_remove_if(queue, elem_match, elem_destroy));
+}
+
+/* ************************************************************************************************/
+
 queue_rc_e queue_clear(queue_s *queue, void (*elem_destroy)(void **))
 {
     return s_l_list_rc_to_queue_rc(s_l_list_clear(queue, elem_destroy));
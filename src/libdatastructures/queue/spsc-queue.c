@@ -0,0 +1,228 @@
+/**
+ * \file   spsc-queue.c
+ * \brief  Wait-free bounded single-producer/single-consumer queue - functions definitions
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include "libdatastructures/queue/spsc-queue.h"
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Get the number of free cells in the queue as seen by the producer, only reading the
+ *          consumer index (instead of its cached copy) if the queue seems not to have enough.
+ * \param   queue  the queue whose free cells are to be counted
+ * \param   tail   the producer index
+ * \param   n      the number of free cells wanted by the producer
+ * \return  the number of free cells in the queue
+ */
+static size_t spsc_queue_room(spsc_queue_s *queue, size_t tail, size_t n)
+{
+    size_t capacity = spsc_queue_capacity(queue);
+
+    if (capacity - (tail - queue->head_cache) < n)
+        queue->head_cache = atomic_load_explicit(&queue->head, memory_order_acquire);
+
+    return capacity - (tail - queue->head_cache);
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Get the number of elements in the queue as seen by the consumer, only reading the
+ *          producer index (instead of its cached copy) if the queue seems not to have enough.
+ * \param   queue  the queue whose elements are to be counted
+ * \param   head   the consumer index
+ * \param   n      the number of elements wanted by the consumer
+ * \return  the number of elements in the queue
+ */
+static size_t spsc_queue_available(spsc_queue_s *queue, size_t head, size_t n)
+{
+    if (queue->tail_cache - head < n)
+        queue->tail_cache = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+    return queue->tail_cache - head;
+}
+
+/* ************************************************************************************************/
+
+void spsc_queue_init(spsc_queue_s *queue, size_t capacity)
+{
+    if (NULL == queue)
+        return;
+
+    size_t length = 1;
+    size_t max_length = SIZE_MAX / sizeof(void *);
+
+    while (length < capacity && length <= max_length / 2)
+        length *= 2;
+
+    /* A capacity whose ring buffer can't even be sized is handled as a failed allocation */
+    queue->elems = (length < capacity ? NULL : (void **)malloc(length * sizeof(void *)));
+    queue->mask = (NULL != queue->elems ? length - 1 : 0);
+    atomic_init(&queue->tail, 0);
+    queue->head_cache = 0;
+    atomic_init(&queue->head, 0);
+    queue->tail_cache = 0;
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+spsc_queue_s *spsc_queue_new(size_t capacity)
+{
+    spsc_queue_s *new_queue = (spsc_queue_s *)malloc(sizeof(*new_queue));
+
+    spsc_queue_init(new_queue, capacity);
+
+    return new_queue;
+}
+
+/* ************************************************************************************************/
+
+spsc_queue_rc_e spsc_queue_enqueue(spsc_queue_s *queue, void *elem)
+{
+    if (NULL == queue)
+        return SPSC_QUEUE_RC_NULL;
+
+    if (NULL == elem)
+        return SPSC_QUEUE_RC_ELEM_NULL;
+
+    if (1 != spsc_queue_enqueue_batch(queue, &elem, 1))
+        return SPSC_QUEUE_RC_FULL;
+
+    return SPSC_QUEUE_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+size_t spsc_queue_enqueue_batch(spsc_queue_s *queue, void **elems, size_t n)
+{
+    if (NULL == queue || NULL == queue->elems || NULL == elems)
+        return 0;
+
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    size_t room = spsc_queue_room(queue, tail, n);
+    size_t i;
+
+    for (i = 0; i < n && i < room && NULL != elems[i]; i++)
+        queue->elems[(tail + i) & queue->mask] = elems[i];
+
+    /* Publish all the elements to the consumer at once */
+    if (i > 0)
+        atomic_store_explicit(&queue->tail, tail + i, memory_order_release);
+
+    return i;
+}
+
+/* ************************************************************************************************/
+
+size_t spsc_queue_count(spsc_queue_s *queue)
+{
+    if (NULL == queue)
+        return 0;
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+    /* The indices are read at different times, so the difference may be out of bounds */
+    if (tail - head > spsc_queue_capacity(queue))
+        return tail < head ? 0 : spsc_queue_capacity(queue);
+
+    return tail - head;
+}
+
+/* ************************************************************************************************/
+
+size_t spsc_queue_capacity(spsc_queue_s *queue)
+{
+    if (NULL == queue || NULL == queue->elems)
+        return 0;
+
+    return queue->mask + 1;
+}
+
+/* ************************************************************************************************/
+
+void *spsc_queue_pick(spsc_queue_s *queue)
+{
+    if (NULL == queue || NULL == queue->elems)
+        return NULL;
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+    if (0 == spsc_queue_available(queue, head, 1))
+        return NULL;
+
+    return queue->elems[head & queue->mask];
+}
+
+/* ************************************************************************************************/
+
+void *spsc_queue_dequeue(spsc_queue_s *queue)
+{
+    void *elem = NULL;
+
+    spsc_queue_dequeue_batch(queue, &elem, 1);
+
+    return elem;
+}
+
+/* ************************************************************************************************/
+
+size_t spsc_queue_dequeue_batch(spsc_queue_s *queue, void **elems, size_t n)
+{
+    if (NULL == queue || NULL == queue->elems || NULL == elems)
+        return 0;
+
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t available = spsc_queue_available(queue, head, n);
+    size_t i;
+
+    for (i = 0; i < n && i < available; i++)
+        elems[i] = queue->elems[(head + i) & queue->mask];
+
+    /* Hand all the cells back to the producer at once */
+    if (i > 0)
+        atomic_store_explicit(&queue->head, head + i, memory_order_release);
+
+    return i;
+}
+
+/* ************************************************************************************************/
+
+spsc_queue_rc_e spsc_queue_clear(spsc_queue_s *queue, void (*elem_destroy)(void **))
+{
+    if (NULL == queue)
+        return SPSC_QUEUE_RC_NULL;
+
+    if (0 == spsc_queue_count(queue))
+        return SPSC_QUEUE_RC_EMPTY;
+
+    spsc_queue_rc_e rc = (NULL == elem_destroy ? SPSC_QUEUE_RC_ELEM_CB_NULL : SPSC_QUEUE_RC_OK);
+    void *elem;
+
+    while (NULL != (elem = spsc_queue_dequeue(queue))) {
+        if (NULL != elem_destroy)
+            elem_destroy(&elem);
+    }
+
+    return rc;
+}
+
+/* ************************************************************************************************/
+
+spsc_queue_rc_e spsc_queue_destroy(spsc_queue_s **queue, void (*elem_destroy)(void **))
+{
+    if (NULL == queue || NULL == *queue)
+        return SPSC_QUEUE_RC_NULL;
+
+    spsc_queue_rc_e rc = spsc_queue_clear(*queue, elem_destroy);
+
+    free((*queue)->elems);
+    free(*queue);
+    *queue = NULL;
+
+    return rc;
+}
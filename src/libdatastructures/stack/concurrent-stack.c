@@ -0,0 +1,392 @@
+/**
+ * \file   concurrent-stack.c
+ * \brief  Lock-free bounded stack (Treiber stack) - functions definitions
+ */
+#include <stdbool.h>
+#include <stdlib.h>
+#include "libdatastructures/stack/concurrent-stack.h"
+
+/** Index of no node, which ends a list of nodes */
+#define CONCURRENT_STACK_NIL UINT32_MAX
+
+/** No. of times a thread checks an elimination slot for a matching operation before giving up */
+#define CONCURRENT_STACK_ELIMINATION_SPINS 64
+
+/** Value of an elimination slot holding no element */
+#define CONCURRENT_STACK_SLOT_EMPTY ((uintptr_t)0)
+
+/** Value of an elimination slot whose element has been taken by a popping thread */
+#define CONCURRENT_STACK_SLOT_TAKEN ((uintptr_t)&concurrent_stack_slot_taken)
+
+/** Dummy object, whose address marks an elimination slot whose element has been taken */
+static const char concurrent_stack_slot_taken;
+
+/** State of the pseudo-random generator choosing the elimination slots (one per thread) */
+static _Thread_local uint32_t concurrent_stack_seed;
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Make the new value of a list head pointing to a node, incrementing the tag of the head.
+ * \param   head  the current value of the list head
+ * \param   idx   index of the node the list head is to point to
+ * \return  the new value of the list head
+ */
+static uint_least64_t concurrent_stack_head_new(uint_least64_t head, uint32_t idx)
+{
+    return (((head >> 32) + 1) << 32) | idx;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Try to link a node at the front of a list, with a single compare-and-swap.
+ * \param   head   the head of the list
+ * \param   nodes  the nodes of the stack
+ * \param   idx    index of the node to be linked
+ * \return  true if the node has been linked, false if the head has been changed meanwhile
+ */
+static bool concurrent_stack_list_try_push(atomic_uint_least64_t *head,
+                                           concurrent_stack_node_s *nodes, uint32_t idx)
+{
+    uint_least64_t old = atomic_load_explicit(head, memory_order_relaxed);
+
+    atomic_store_explicit(&nodes[idx].next, (uint32_t)old, memory_order_relaxed);
+
+    return atomic_compare_exchange_strong_explicit(head, &old,
+                                                   concurrent_stack_head_new(old, idx),
+                                                   memory_order_release, memory_order_relaxed);
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief  Link a node at the front of a list.
+ * \param  head   the head of the list
+ * \param  nodes  the nodes of the stack
+ * \param  idx    index of the node to be linked
+ */
+static void concurrent_stack_list_push(atomic_uint_least64_t *head,
+                                       concurrent_stack_node_s *nodes, uint32_t idx)
+{
+    while (!concurrent_stack_list_try_push(head, nodes, idx))
+        ;
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Try to unlink the node at the front of a list, with a single compare-and-swap.
+ * \param   head   the head of the list
+ * \param   nodes  the nodes of the stack
+ * \param   idx    where the index of the unlinked node is to be stored ('CONCURRENT_STACK_NIL' if
+ *                 the list is empty)
+ * \return  true if a node has been unlinked or the list is empty, false if the head has been
+ *          changed meanwhile
+ */
+static bool concurrent_stack_list_try_pop(atomic_uint_least64_t *head,
+                                          concurrent_stack_node_s *nodes, uint32_t *idx)
+{
+    uint_least64_t old = atomic_load_explicit(head, memory_order_acquire);
+
+    *idx = (uint32_t)old;
+
+    if (CONCURRENT_STACK_NIL == *idx)
+        return true;
+
+    /* The node may be popped and pushed back by another thread meanwhile, but then the tag of the
+       head has changed, so the compare-and-swap fails */
+    uint32_t next = (uint32_t)atomic_load_explicit(&nodes[*idx].next, memory_order_relaxed);
+
+    return atomic_compare_exchange_strong_explicit(head, &old,
+                                                   concurrent_stack_head_new(old, next),
+                                                   memory_order_acquire, memory_order_relaxed);
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Unlink the node at the front of a list.
+ * \param   head   the head of the list
+ * \param   nodes  the nodes of the stack
+ * \return  index of the unlinked node, or 'CONCURRENT_STACK_NIL' if the list is empty
+ */
+static uint32_t concurrent_stack_list_pop(atomic_uint_least64_t *head,
+                                          concurrent_stack_node_s *nodes)
+{
+    uint32_t idx;
+
+    while (!concurrent_stack_list_try_pop(head, nodes, &idx))
+        ;
+
+    return idx;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Choose a random slot of the elimination array of the stack.
+ * \param   stack  the stack whose elimination slot is to be chosen
+ * \return  the chosen slot
+ */
+static atomic_uintptr_t *concurrent_stack_slot_random(concurrent_stack_s *stack)
+{
+    uint32_t x = concurrent_stack_seed;
+
+    /* Every thread starts off a different seed: the address of its own generator state */
+    if (0 == x)
+        x = (uint32_t)(uintptr_t)&concurrent_stack_seed | 1;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    concurrent_stack_seed = x;
+
+    return &stack->slots[x % stack->nslots];
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Try to hand an element to a popping thread through the elimination array.
+ * \param   stack  the stack where the element is to be pushed
+ * \param   elem   the element to be pushed
+ * \return  true if a popping thread has taken the element, false otherwise
+ */
+static bool concurrent_stack_eliminate_push(concurrent_stack_s *stack, void *elem)
+{
+    if (0 == stack->nslots)
+        return false;
+
+    atomic_uintptr_t *slot = concurrent_stack_slot_random(stack);
+    uintptr_t expected = CONCURRENT_STACK_SLOT_EMPTY;
+
+    if (!atomic_compare_exchange_strong_explicit(slot, &expected, (uintptr_t)elem,
+                                                 memory_order_release, memory_order_relaxed))
+        return false;
+
+    for (int i = 0; i < CONCURRENT_STACK_ELIMINATION_SPINS; i++) {
+        if (CONCURRENT_STACK_SLOT_TAKEN == atomic_load_explicit(slot, memory_order_relaxed)) {
+            atomic_store_explicit(slot, CONCURRENT_STACK_SLOT_EMPTY, memory_order_relaxed);
+            return true;
+        }
+    }
+
+    /* Withdraw the element, unless it's been taken right now */
+    expected = (uintptr_t)elem;
+
+    if (atomic_compare_exchange_strong_explicit(slot, &expected, CONCURRENT_STACK_SLOT_EMPTY,
+                                                memory_order_relaxed, memory_order_relaxed))
+        return false;
+
+    atomic_store_explicit(slot, CONCURRENT_STACK_SLOT_EMPTY, memory_order_relaxed);
+
+    return true;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Try to take an element from a pushing thread through the elimination array.
+ * \param   stack  the stack from where the element is to be popped
+ * \return  the element taken, or null if no pushing thread has handed one
+ */
+static void *concurrent_stack_eliminate_pop(concurrent_stack_s *stack)
+{
+    if (0 == stack->nslots)
+        return NULL;
+
+    atomic_uintptr_t *slot = concurrent_stack_slot_random(stack);
+
+    for (int i = 0; i < CONCURRENT_STACK_ELIMINATION_SPINS; i++) {
+        uintptr_t elem = atomic_load_explicit(slot, memory_order_relaxed);
+
+        if (CONCURRENT_STACK_SLOT_EMPTY == elem || CONCURRENT_STACK_SLOT_TAKEN == elem)
+            continue;
+
+        if (atomic_compare_exchange_strong_explicit(slot, &elem, CONCURRENT_STACK_SLOT_TAKEN,
+                                                    memory_order_acquire, memory_order_relaxed))
+            return (void *)elem;
+    }
+
+    return NULL;
+}
+
+/* ************************************************************************************************/
+
+void concurrent_stack_init(concurrent_stack_s *stack, size_t capacity, size_t nslots)
+{
+    if (NULL == stack)
+        return;
+
+    stack->nodes = NULL;
+    stack->capacity = 0;
+
+    if (capacity > 0 && capacity < CONCURRENT_STACK_NIL)
+        stack->nodes = (concurrent_stack_node_s *)malloc(capacity * sizeof(*stack->nodes));
+
+    if (NULL != stack->nodes) {
+        stack->capacity = (uint32_t)capacity;
+
+        /* All the nodes are linked into the free nodes list, in order */
+        for (uint32_t i = 0; i < stack->capacity; i++) {
+            stack->nodes[i].elem = NULL;
+            atomic_init(&stack->nodes[i].next,
+                        i + 1 < stack->capacity ? i + 1 : CONCURRENT_STACK_NIL);
+        }
+    }
+
+    stack->slots = NULL;
+    stack->nslots = 0;
+
+    if (nslots > 0)
+        stack->slots = (atomic_uintptr_t *)malloc(nslots * sizeof(*stack->slots));
+
+    if (NULL != stack->slots) {
+        stack->nslots = nslots;
+
+        for (size_t i = 0; i < nslots; i++)
+            atomic_init(&stack->slots[i], CONCURRENT_STACK_SLOT_EMPTY);
+    }
+
+    atomic_init(&stack->top, CONCURRENT_STACK_NIL);
+    atomic_init(&stack->free, 0 < stack->capacity ? 0 : CONCURRENT_STACK_NIL);
+    atomic_init(&stack->count, 0);
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+concurrent_stack_s *concurrent_stack_new(size_t capacity, size_t nslots)
+{
+    concurrent_stack_s *new_stack = (concurrent_stack_s *)malloc(sizeof(*new_stack));
+
+    concurrent_stack_init(new_stack, capacity, nslots);
+
+    return new_stack;
+}
+
+/* ************************************************************************************************/
+
+concurrent_stack_rc_e concurrent_stack_push(concurrent_stack_s *stack, void *elem)
+{
+    if (NULL == stack)
+        return CONCURRENT_STACK_RC_NULL;
+
+    if (NULL == elem)
+        return CONCURRENT_STACK_RC_ELEM_NULL;
+
+    if (NULL == stack->nodes)
+        return CONCURRENT_STACK_RC_FULL;
+
+    uint32_t idx = concurrent_stack_list_pop(&stack->free, stack->nodes);
+
+    if (CONCURRENT_STACK_NIL == idx)
+        return CONCURRENT_STACK_RC_FULL;
+
+    stack->nodes[idx].elem = elem;
+
+    /* The count is incremented beforehand, so a popping thread never makes it negative */
+    atomic_fetch_add_explicit(&stack->count, 1, memory_order_relaxed);
+
+    while (!concurrent_stack_list_try_push(&stack->top, stack->nodes, idx)) {
+        if (concurrent_stack_eliminate_push(stack, elem)) {
+            atomic_fetch_sub_explicit(&stack->count, 1, memory_order_relaxed);
+            concurrent_stack_list_push(&stack->free, stack->nodes, idx);
+            break;
+        }
+    }
+
+    return CONCURRENT_STACK_RC_OK;
+}
+
+/* ************************************************************************************************/
+
+void *concurrent_stack_pop(concurrent_stack_s *stack)
+{
+    if (NULL == stack || NULL == stack->nodes)
+        return NULL;
+
+    uint32_t idx;
+
+    while (!concurrent_stack_list_try_pop(&stack->top, stack->nodes, &idx)) {
+        void *elem = concurrent_stack_eliminate_pop(stack);
+
+        if (NULL != elem)
+            return elem;
+    }
+
+    if (CONCURRENT_STACK_NIL == idx)
+        return NULL;
+
+    void *elem = stack->nodes[idx].elem;
+
+    atomic_fetch_sub_explicit(&stack->count, 1, memory_order_relaxed);
+    concurrent_stack_list_push(&stack->free, stack->nodes, idx);
+
+    return elem;
+}
+
+/* ************************************************************************************************/
+
+size_t concurrent_stack_count(concurrent_stack_s *stack)
+{
+    if (NULL == stack)
+        return 0;
+
+    return atomic_load_explicit(&stack->count, memory_order_relaxed);
+}
+
+/* ************************************************************************************************/
+
+size_t concurrent_stack_capacity(concurrent_stack_s *stack)
+{
+    if (NULL == stack)
+        return 0;
+
+    return stack->capacity;
+}
+
+/* ************************************************************************************************/
+
+concurrent_stack_rc_e concurrent_stack_clear(concurrent_stack_s *stack,
+                                             void (*elem_destroy)(void **))
+{
+    if (NULL == stack)
+        return CONCURRENT_STACK_RC_NULL;
+
+    if (0 == concurrent_stack_count(stack))
+        return CONCURRENT_STACK_RC_EMPTY;
+
+    concurrent_stack_rc_e rc = (NULL == elem_destroy ? CONCURRENT_STACK_RC_ELEM_CB_NULL
+                                                     : CONCURRENT_STACK_RC_OK);
+    void *elem;
+
+    while (NULL != (elem = concurrent_stack_pop(stack))) {
+        if (NULL != elem_destroy)
+            elem_destroy(&elem);
+    }
+
+    return rc;
+}
+
+/* ************************************************************************************************/
+
+concurrent_stack_rc_e concurrent_stack_destroy(concurrent_stack_s **stack,
+                                               void (*elem_destroy)(void **))
+{
+    if (NULL == stack || NULL == *stack)
+        return CONCURRENT_STACK_RC_NULL;
+
+    concurrent_stack_rc_e rc = concurrent_stack_clear(*stack, elem_destroy);
+
+    free((*stack)->nodes);
+    free((*stack)->slots);
+    free(*stack);
+    *stack = NULL;
+
+    return rc;
+}
@@ -3,6 +3,7 @@
  * \brief  Stack data structure - functions definitions
  */
 #include <stdlib.h>
+#include "libdatastructures/array/array.h"
 #include "libdatastructures/list/singly-linked-list.h"
 #include "libdatastructures/stack/stack.h"
 
@@ -33,6 +34,46 @@ static stack_rc_e s_l_list_rc_to_stack_rc(s_l_list_rc_e rc)
         case S_L_LIST_RC_NODE_ALLOC_ERR:
             new_rc = STACK_RC_NODE_ALLOC_ERR;
             break;
+        case S_L_LIST_RC_NOT_EMPTY:
+            new_rc = STACK_RC_NOT_EMPTY;
+            break;
+        case S_L_LIST_RC_INVALID_POOL:
+            new_rc = STACK_RC_INVALID_POOL;
+            break;
+        default:
+            new_rc = STACK_RC_NULL;
+    }
+
+    return new_rc;
+}
+
+/* ************************************************************************************************/
+
+/**
+ * \brief   Convert an array return code to a stack one
+ * \param   rc  the array operation return code
+ * \return  an equivalent stack operation return code
+ */
+static stack_rc_e array_rc_to_stack_rc(array_rc_e rc)
+{
+    stack_rc_e new_rc;
+
+    switch (rc) {
+        case ARRAY_RC_OK:
+            new_rc = STACK_RC_OK;
+            break;
+        case ARRAY_RC_EMPTY:
+            new_rc = STACK_RC_EMPTY;
+            break;
+        case ARRAY_RC_ELEM_NULL:
+            new_rc = STACK_RC_ELEM_NULL;
+            break;
+        case ARRAY_RC_ELEM_CB_NULL:
+            new_rc = STACK_RC_ELEM_CB_NULL;
+            break;
+        case ARRAY_RC_NODE_ALLOC_ERR:
+            new_rc = STACK_RC_NODE_ALLOC_ERR;
+            break;
         default:
             new_rc = STACK_RC_NULL;
     }
@@ -44,7 +85,11 @@ static stack_rc_e s_l_list_rc_to_stack_rc(s_l_list_rc_e rc)
 
 void stack_init(stack_s *stack)
 {
-    s_l_list_init(stack);
+    if (NULL != stack) {
+        s_l_list_init(&stack->list);
+        array_init(&stack->array, 0);
+        stack->contiguous = false;
+    }
 
     return;
 }
@@ -53,14 +98,69 @@ void stack_init(stack_s *stack)
 
 stack_s *stack_new(void)
 {
-    return s_l_list_new();
+    stack_s *new_stack = (stack_s *)malloc(sizeof(*new_stack));
+
+    stack_init(new_stack);
+
+    return new_stack;
+}
+
+/* ************************************************************************************************/
+
+void stack_init_contiguous(stack_s *stack, size_t capacity)
+{
+    if (NULL != stack) {
+        s_l_list_init(&stack->list);
+        array_init_growable(&stack->array, capacity);
+        stack->contiguous = true;
+    }
+
+    return;
+}
+
+/* ************************************************************************************************/
+
+stack_s *stack_new_contiguous(size_t capacity)
+{
+    stack_s *new_stack = (stack_s *)malloc(sizeof(*new_stack));
+
+    stack_init_contiguous(new_stack, capacity);
+
+    return new_stack;
+}
+
+/* ************************************************************************************************/
+
+stack_rc_e stack_set_pool(stack_s *stack, node_pool_s *pool)
+{
+    if (NULL == stack)
+        return STACK_RC_NULL;
+
+    if (stack->contiguous) {
+        if (array_count(&stack->array) > 0)
+            return STACK_RC_NOT_EMPTY;
+
+        return (NULL == pool ? STACK_RC_OK : STACK_RC_INVALID_POOL);
+    }
+
+    return s_l_list_rc_to_stack_rc(s_l_list_set_pool(&stack->list, pool));
 }
 
 /* ************************************************************************************************/
 
 stack_rc_e stack_push(stack_s *stack, void *elem)
 {
-    return s_l_list_rc_to_stack_rc(s_l_list_insert_front(stack, elem));
+    if (NULL == stack)
+        return STACK_RC_NULL;
+
+    if (!stack->contiguous)
+        return s_l_list_rc_to_stack_rc(s_l_list_insert_front(&stack->list, elem));
+
+    /* Don't allow pushing null elements, just like onto a non-contiguous stack */
+    if (NULL == elem)
+        return STACK_RC_ELEM_NULL;
+
+    return array_rc_to_stack_rc(array_push_back(&stack->array, elem));
 }
 
 /* ************************************************************************************************/
@@ -70,43 +170,91 @@ size_t stack_count(stack_s *stack)
     if (NULL == stack)
         return 0;
 
-    return stack->count;
+    return (stack->contiguous ? array_count(&stack->array) : stack->list.count);
 }
 
 /* ************************************************************************************************/
 
 stack_rc_e stack_traverse(stack_s *stack, void (*elem_visit)(void *))
 {
-    return s_l_list_rc_to_stack_rc(s_l_list_traverse(stack, elem_visit));
+    if (NULL == stack)
+        return STACK_RC_NULL;
+
+    if (!stack->contiguous)
+        return s_l_list_rc_to_stack_rc(s_l_list_traverse(&stack->list, elem_visit));
+
+    size_t count = array_count(&stack->array);
+
+    if (0 == count)
+        return STACK_RC_EMPTY;
+
+    if (NULL == elem_visit)
+        return STACK_RC_ELEM_CB_NULL;
+
+    /* The top of the stack is the back of the array */
+    for (size_t i = count; i > 0; i--)
+        elem_visit(array_pick_at_idx(&stack->array, i - 1));
+
+    return STACK_RC_OK;
 }
 
 /* ************************************************************************************************/
 
 void *stack_pick(stack_s *stack)
 {
-    if (NULL == stack || NULL == stack->back)
+    if (NULL == stack)
         return NULL;
 
-    return stack->back->next->elem;
+    if (stack->contiguous)
+        return array_pick_back(&stack->array);
+
+    if (NULL == stack->list.back)
+        return NULL;
+
+    return stack->list.back->next->elem;
 }
 
 /* ************************************************************************************************/
 
 void *stack_pop(stack_s *stack)
 {
-    return s_l_list_remove_front(stack);
+    if (NULL == stack)
+        return NULL;
+
+    if (stack->contiguous)
+        return array_pop_back(&stack->array);
+
+    return s_l_list_remove_front(&stack->list);
 }
 
 /* ************************************************************************************************/
 
 stack_rc_e stack_clear(stack_s *stack, void (*elem_destroy)(void **))
 {
-    return s_l_list_rc_to_stack_rc(s_l_list_clear(stack, elem_destroy));
+    if (NULL == stack)
+        return STACK_RC_NULL;
+
+    /* A contiguous stack keeps the capacity of its array, so it doesn't have to grow it again */
+    if (stack->contiguous)
+        return array_rc_to_stack_rc(array_clear(&stack->array, elem_destroy));
+
+    return s_l_list_rc_to_stack_rc(s_l_list_clear(&stack->list, elem_destroy));
 }
 
 /* ************************************************************************************************/
 
 stack_rc_e stack_destroy(stack_s **stack, void (*elem_destroy)(void **))
 {
-    return s_l_list_rc_to_stack_rc(s_l_list_destroy(stack, elem_destroy));
+    if (NULL == stack || NULL == *stack)
+        return STACK_RC_NULL;
+
+    stack_rc_e rc = stack_clear(*stack, elem_destroy);
+
+    /* Deallocate the (now empty) storage of the array */
+    array_shrink_to_fit(&(*stack)->array);
+
+    free(*stack);
+    *stack = NULL;
+
+    return rc;
 }
@@ -3,13 +3,79 @@
  * \brief  Array data structure - unit test simulation for basic functions
  */
 #include <assert.h>
+#include <limits.h>
+#include <stdint.h>
 #include "libdatastructures/array/array.h"
 #include "number/number.h"
 
+/**
+ * \brief  Assert the array stores exactly the given numbers, in the same order.
+ * \param  a         the array whose elements are to be checked
+ * \param  expected  the expected numbers
+ * \param  n         the expected number of elements
+ */
+static void assert_numbers(array_s *a, const int *expected, size_t n)
+{
+    assert(n == array_count(a));
+
+    for (size_t i = 0; i < n; i++) {
+        void *num = array_pick_at_idx(a, i);
+        assert(NULL != num && expected[i] == *(int *)num);
+    }
+
+    return;
+}
+
+/**
+ * \brief   Get the key of a number element, preserving the order of signed numbers.
+ * \param   num  the number element
+ * \return  the number as an unsigned key
+ */
+static uint64_t number_key(void *num)
+{
+    return (uint64_t)(int64_t)(*(int *)num) ^ (UINT64_C(1) << 63);
+}
+
+/**
+ * \brief  Double a number element; it's safe to be called concurrently for distinct elements.
+ * \param  num  the number element
+ */
+static void number_double(void *num)
+{
+    *(int *)num *= 2;
+
+    return;
+}
+
+/**
+ * \brief  Add a number element onto a sum accumulator.
+ * \param  sum  the sum accumulator
+ * \param  num  the number element
+ */
+static void number_sum(void *sum, void *num)
+{
+    *(long long *)sum += *(int *)num;
+
+    return;
+}
+
+/**
+ * \brief  Combine a partial sum accumulator onto another one.
+ * \param  sum    the sum accumulator to be combined onto
+ * \param  other  the sum accumulator to be combined
+ */
+static void number_sum_combine(void *sum, void *other)
+{
+    *(long long *)sum += *(long long *)other;
+
+    return;
+}
+
 int main(void)
 {
     array_rc_e rc;
     void *tmp;
+    int num;
 
     /* Part 1. Null array */
     array_s *numbers = NULL;
@@ -277,11 +343,549 @@ int main(void)
     assert(ARRAY_RC_FULL == rc && 3 == array_count(numbers));
     number_destroy(&tmp);
 
+    /* It should fail when trying to reserve or shrink the storage of a null array */
+    rc = array_reserve(NULL, 10);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_shrink_to_fit(NULL);
+    assert(ARRAY_RC_NULL == rc);
+    assert(0 == array_capacity(NULL));
+
+    /* It should succeed when trying to make room on a full array by reserving its storage */
+    rc = array_reserve(numbers, 4);
+    assert(ARRAY_RC_OK == rc && 4 == array_capacity(numbers) && 3 == array_count(numbers));
+    rc = array_push_back(numbers, tmp = number_new(40));
+    assert(ARRAY_RC_OK == rc && 4 == array_count(numbers));
+    rc = array_push_back(numbers, tmp);
+    assert(ARRAY_RC_FULL == rc && 4 == array_count(numbers));
+
     /* End of part 4. */
 
     rc = array_destroy(&numbers, number_destroy);
     assert(ARRAY_RC_OK == rc && NULL == numbers);
 
+    /* Part 5. Growable array */
+
+    numbers = array_new_growable(0);
+    assert(NULL != numbers && 0 == array_capacity(numbers) && 0 == array_count(numbers));
+
+    /* It should never get full, growing geometrically as the elements are pushed onto it */
+    size_t reallocs = 0;
+
+    for (int i = 0; i < 1000; i++) {
+        size_t capacity = array_capacity(numbers);
+        tmp = number_new(i);
+        rc = (i % 2 ? array_push_back(numbers, tmp) : array_push_front(numbers, tmp));
+        assert(ARRAY_RC_OK == rc && (size_t)i + 1 == array_count(numbers));
+        reallocs += (capacity != array_capacity(numbers));
+    }
+
+    assert(reallocs <= 8 && array_capacity(numbers) >= 1000);
+    tmp = array_pick_front(numbers);
+    assert(NULL != tmp && 998 == *(int *)tmp);
+    tmp = array_pick_back(numbers);
+    assert(NULL != tmp && 999 == *(int *)tmp);
+
+    /* It should succeed when trying to shrink the storage to fit the elements */
+    for (int i = 0; i < 500; i++) {
+        tmp = array_pop_back(numbers);
+        number_destroy(&tmp);
+    }
+
+    rc = array_shrink_to_fit(numbers);
+    assert(ARRAY_RC_OK == rc && 500 == array_capacity(numbers) && 500 == array_count(numbers));
+
+    /* It should keep growing after having its storage shrunk */
+    rc = array_push_at(numbers, number_new(-1), 250);
+    assert(ARRAY_RC_OK == rc && 501 == array_count(numbers) && 1000 == array_capacity(numbers));
+    tmp = array_pick_at(numbers, 250);
+    assert(NULL != tmp && -1 == *(int *)tmp);
+
+    /* It should not shorten the storage when reserving less than the current capacity */
+    rc = array_reserve(numbers, 10);
+    assert(ARRAY_RC_OK == rc && 1000 == array_capacity(numbers));
+    rc = array_reserve(numbers, 5000);
+    assert(ARRAY_RC_OK == rc && 5000 == array_capacity(numbers) && 501 == array_count(numbers));
+
+    /* It should release the whole storage when shrinking an empty array */
+    rc = array_clear(numbers, number_destroy);
+    assert(ARRAY_RC_OK == rc && 0 == array_count(numbers));
+    rc = array_shrink_to_fit(numbers);
+    assert(ARRAY_RC_OK == rc && 0 == array_capacity(numbers));
+
+    rc = array_destroy(&numbers, number_destroy);
+    assert(ARRAY_RC_EMPTY == rc && NULL == numbers);
+
+    /* End of part 5. */
+
+    /* Part 6. Sliding window over a full array */
+
+    numbers = array_new(4);
+    assert(NULL != numbers && 4 == array_capacity(numbers) && 0 == array_count(numbers));
+
+    for (int i = 0; i < 4; i++) {
+        rc = array_push_back(numbers, number_new(i));
+        assert(ARRAY_RC_OK == rc && (size_t)i + 1 == array_count(numbers));
+    }
+
+    /* It should keep the elements in order while they wrap around the end of the storage */
+    for (int i = 4; i < 11; i++) {
+        tmp = array_pop_front(numbers);
+        assert(NULL != tmp && i - 4 == *(int *)tmp && 3 == array_count(numbers));
+        number_destroy(&tmp);
+        rc = array_push_back(numbers, number_new(i));
+        assert(ARRAY_RC_OK == rc && 4 == array_count(numbers));
+
+        for (int j = 0; j < 4; j++) {
+            tmp = array_pick_at(numbers, j);
+            assert(NULL != tmp && i - 3 + j == *(int *)tmp);
+        }
+    }
+
+    /* It should shift the elements across the end of the storage */
+    tmp = array_pop_at(numbers, 1);
+    assert(NULL != tmp && 8 == *(int *)tmp && 3 == array_count(numbers));
+    rc = array_push_at(numbers, tmp, 1);
+    assert(ARRAY_RC_OK == rc && 4 == array_count(numbers));
+    tmp = array_pop_at(numbers, 2);
+    assert(NULL != tmp && 9 == *(int *)tmp && 3 == array_count(numbers));
+    rc = array_push_at(numbers, tmp, 2);
+    assert(ARRAY_RC_OK == rc && 4 == array_count(numbers));
+
+    for (int j = 0; j < 4; j++) {
+        tmp = array_pick_at(numbers, j);
+        assert(NULL != tmp && 7 + j == *(int *)tmp);
+    }
+
+    /* It should fail when trying to push an element onto either end of the full array */
+    rc = array_push_front(numbers, NULL);
+    assert(ARRAY_RC_FULL == rc && 4 == array_count(numbers));
+    rc = array_push_back(numbers, NULL);
+    assert(ARRAY_RC_FULL == rc && 4 == array_count(numbers));
+
+    /* It should keep the elements in order when reallocating a wrapped storage */
+    rc = array_reserve(numbers, 6);
+    assert(ARRAY_RC_OK == rc && 6 == array_capacity(numbers));
+    rc = array_push_front(numbers, number_new(6));
+    assert(ARRAY_RC_OK == rc && 5 == array_count(numbers));
+    rc = array_push_back(numbers, number_new(11));
+    assert(ARRAY_RC_OK == rc && 6 == array_count(numbers));
+
+    for (int j = 0; j < 6; j++) {
+        tmp = array_pick_at(numbers, j);
+        assert(NULL != tmp && 6 + j == *(int *)tmp);
+    }
+
+    rc = array_destroy(&numbers, number_destroy);
+    assert(ARRAY_RC_OK == rc && NULL == numbers);
+
+    /* End of part 6. */
+
+    /* Part 7. Range insertion and removal */
+
+    void *range[4];
+
+    /* It should fail when trying to insert or remove a range of elements of a null array */
+    rc = array_insert_range(NULL, 0, range, 4);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_erase_range(NULL, 0, 4, number_destroy);
+    assert(ARRAY_RC_NULL == rc);
+
+    numbers = array_new(8);
+    assert(NULL != numbers && 8 == array_capacity(numbers) && 0 == array_count(numbers));
+
+    /* It should fail when trying to remove a range of elements of an empty array */
+    rc = array_erase_range(numbers, 0, 0, number_destroy);
+    assert(ARRAY_RC_EMPTY == rc);
+
+    /* It should fail when trying to insert a range of elements onto an invalid position, or
+       without the elements provided */
+    rc = array_insert_range(numbers, 1, range, 4);
+    assert(ARRAY_RC_INVALID_POS == rc && 0 == array_count(numbers));
+    rc = array_insert_range(numbers, 0, NULL, 4);
+    assert(ARRAY_RC_ELEM_NULL == rc && 0 == array_count(numbers));
+
+    /* It should succeed when trying to insert ranges of elements onto a fixed-length array */
+    for (int i = 0; i < 4; i++)
+        range[i] = number_new(10 + i);
+
+    rc = array_insert_range(numbers, 0, range, 4);
+    assert(ARRAY_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 10, 11, 12, 13 }, 4);
+
+    for (int i = 0; i < 3; i++)
+        range[i] = number_new(20 + i);
+
+    rc = array_insert_range(numbers, 1, range, 3);
+    assert(ARRAY_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 10, 20, 21, 22, 11, 12, 13 }, 7);
+
+    /* It should fail when trying to insert more elements than the fixed-length array can store */
+    rc = array_insert_range(numbers, 7, range, 2);
+    assert(ARRAY_RC_FULL == rc && 7 == array_count(numbers));
+
+    /* It should fail when trying to remove a range of elements beyond the end of the array */
+    rc = array_erase_range(numbers, 5, 3, number_destroy);
+    assert(ARRAY_RC_INVALID_POS == rc && 7 == array_count(numbers));
+    rc = array_erase_range(numbers, 8, 0, number_destroy);
+    assert(ARRAY_RC_INVALID_POS == rc && 7 == array_count(numbers));
+
+    /* It should succeed when trying to remove ranges of elements from either side of the array */
+    rc = array_erase_range(numbers, 0, 2, number_destroy);
+    assert(ARRAY_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 21, 22, 11, 12, 13 }, 5);
+    rc = array_erase_range(numbers, 3, 1, number_destroy);
+    assert(ARRAY_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 21, 22, 11, 13 }, 4);
+
+    /* It should keep the elements in order when the ranges wrap around the end of the storage */
+    for (int i = 0; i < 3; i++)
+        range[i] = number_new(30 + i);
+
+    rc = array_insert_range(numbers, 1, range, 3);
+    assert(ARRAY_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 21, 30, 31, 32, 22, 11, 13 }, 7);
+
+    range[0] = number_new(40);
+    rc = array_insert_range(numbers, 5, range, 1);
+    assert(ARRAY_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 21, 30, 31, 32, 22, 40, 11, 13 }, 8);
+
+    rc = array_erase_range(numbers, 2, 5, number_destroy);
+    assert(ARRAY_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 21, 30, 13 }, 3);
+
+    /* It should not shift any element when inserting or removing an empty range */
+    rc = array_insert_range(numbers, 2, range, 0);
+    assert(ARRAY_RC_OK == rc && 3 == array_count(numbers));
+    rc = array_erase_range(numbers, 2, 0, number_destroy);
+    assert(ARRAY_RC_OK == rc && 3 == array_count(numbers));
+
+    /* It should only remove the range of elements when no callback function is provided */
+    tmp = array_pick_at(numbers, 1);
+    rc = array_erase_range(numbers, 1, 1, NULL);
+    assert(ARRAY_RC_ELEM_CB_NULL == rc);
+    assert_numbers(numbers, (const int[]){ 21, 13 }, 2);
+    number_destroy(&tmp);
+
+    /* It should grow a growable array to fit a range of elements */
+    array_s *more_numbers = array_new_growable(2);
+    assert(NULL != more_numbers && 2 == array_capacity(more_numbers));
+
+    for (int i = 0; i < 2; i++)
+        range[i] = array_pop_front(numbers);
+
+    range[2] = number_new(50);
+    rc = array_insert_range(more_numbers, 0, range, 3);
+    assert(ARRAY_RC_OK == rc && 3 <= array_capacity(more_numbers));
+    assert_numbers(more_numbers, (const int[]){ 21, 13, 50 }, 3);
+
+    rc = array_destroy(&more_numbers, number_destroy);
+    assert(ARRAY_RC_OK == rc && NULL == more_numbers);
+    rc = array_destroy(&numbers, number_destroy);
+    assert(ARRAY_RC_EMPTY == rc && NULL == numbers);
+
+    /* End of part 7. */
+
+    /* Part 8. Sorting */
+
+    /* It should fail when trying to sort a null or an empty array */
+    rc = array_sort(NULL, number_compare);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_sort_by_key(NULL, number_key);
+    assert(ARRAY_RC_NULL == rc);
+
+    numbers = array_new_growable(0);
+    assert(NULL != numbers && 0 == array_count(numbers));
+
+    rc = array_sort(numbers, number_compare);
+    assert(ARRAY_RC_EMPTY == rc);
+    rc = array_sort_by_key(numbers, number_key);
+    assert(ARRAY_RC_EMPTY == rc);
+
+    /* Push a permutation of 0..999 (with every tenth number negated), wrapping the storage */
+    for (int i = 0; i < 1000; i++) {
+        num = (i * 7919) % 1000;
+        tmp = number_new(num % 10 ? num : -num);
+        rc = (i % 3 ? array_push_back(numbers, tmp) : array_push_front(numbers, tmp));
+        assert(ARRAY_RC_OK == rc);
+    }
+
+    /* It should fail when trying to sort an array without a callback function provided */
+    rc = array_sort(numbers, NULL);
+    assert(ARRAY_RC_ELEM_CB_NULL == rc);
+    rc = array_sort_by_key(numbers, NULL);
+    assert(ARRAY_RC_ELEM_CB_NULL == rc);
+
+    /* It should succeed when sorting the array by comparing its elements */
+    rc = array_sort(numbers, number_compare);
+    assert(ARRAY_RC_OK == rc && 1000 == array_count(numbers));
+
+    for (int i = 1; i < 1000; i++)
+        assert(*(int *)array_pick_at(numbers, i - 1) < *(int *)array_pick_at(numbers, i));
+
+    /* It should succeed when sorting an already sorted or reversed array */
+    rc = array_sort(numbers, number_compare);
+    assert(ARRAY_RC_OK == rc && -990 == *(int *)array_pick_front(numbers));
+
+    for (int i = 0; i < 500; i++) {
+        rc = array_swap(numbers, i, 999 - i);
+        assert(ARRAY_RC_OK == rc);
+    }
+
+    rc = array_sort(numbers, number_compare);
+    assert(ARRAY_RC_OK == rc && -990 == *(int *)array_pick_front(numbers));
+
+    for (int i = 1; i < 1000; i++)
+        assert(*(int *)array_pick_at(numbers, i - 1) < *(int *)array_pick_at(numbers, i));
+
+    /* It should succeed when sorting the array by the elements keys, keeping equal keys in the
+       same order */
+    for (int i = 0; i < 1000; i++) {
+        tmp = array_pop_front(numbers);
+        *(int *)tmp %= 10;
+        rc = array_push_back(numbers, tmp);
+        assert(ARRAY_RC_OK == rc);
+    }
+
+    num = 0;
+    void *first_zero = array_pick_at(numbers, array_find_next(numbers, &num, 0, number_compare));
+    rc = array_sort_by_key(numbers, number_key);
+    assert(ARRAY_RC_OK == rc && 1000 == array_count(numbers));
+
+    for (int i = 1; i < 1000; i++)
+        assert(*(int *)array_pick_at(numbers, i - 1) <= *(int *)array_pick_at(numbers, i));
+
+    assert(first_zero == array_pick_at(numbers, array_find_next(numbers, &num, 0, number_compare)));
+
+    rc = array_destroy(&numbers, number_destroy);
+    assert(ARRAY_RC_OK == rc && NULL == numbers);
+
+    /* End of part 8. */
+
+    /* Part 9. Binary search and sorted insertion */
+
+    num = 5;
+
+    /* It should not find anything when searching a null array or without a callback function */
+    assert(0 == array_lower_bound(NULL, &num, number_compare));
+    assert(0 == array_upper_bound(NULL, &num, number_compare));
+    assert(ARRAY_POS_NONE == array_binary_search(NULL, &num, number_compare));
+    rc = array_insert_sorted(NULL, &num, number_compare);
+    assert(ARRAY_RC_NULL == rc);
+
+    numbers = array_new(16);
+    assert(NULL != numbers && 0 == array_count(numbers));
+
+    assert(0 == array_lower_bound(numbers, &num, NULL));
+    assert(ARRAY_POS_NONE == array_binary_search(numbers, &num, NULL));
+    rc = array_insert_sorted(numbers, &num, NULL);
+    assert(ARRAY_RC_ELEM_CB_NULL == rc && 0 == array_count(numbers));
+
+    /* It should not find anything when searching an empty array */
+    assert(0 == array_lower_bound(numbers, &num, number_compare));
+    assert(0 == array_upper_bound(numbers, &num, number_compare));
+    assert(ARRAY_POS_NONE == array_binary_search(numbers, &num, number_compare));
+
+    /* It should keep the array sorted when inserting elements onto it, placing every element
+       after the 'equal' ones */
+    const int sorted_nums[] = { 8, 2, 6, 4, 4, 0, 8, 4, 10, 2 };
+
+    for (int i = 0; i < 10; i++) {
+        rc = array_insert_sorted(numbers, number_new(sorted_nums[i]), number_compare);
+        assert(ARRAY_RC_OK == rc && (size_t)i + 1 == array_count(numbers));
+    }
+
+    assert_numbers(numbers, (const int[]){ 0, 2, 2, 4, 4, 4, 6, 8, 8, 10 }, 10);
+
+    tmp = number_new(4);
+    void *last_four = tmp;
+    rc = array_insert_sorted(numbers, tmp, number_compare);
+    assert(ARRAY_RC_OK == rc && last_four == array_pick_at(numbers, 6));
+
+    /* It should find the bounds of both existing and non-existing elements */
+    num = 4;
+    assert(3 == array_lower_bound(numbers, &num, number_compare));
+    assert(7 == array_upper_bound(numbers, &num, number_compare));
+    assert(3 == array_binary_search(numbers, &num, number_compare));
+
+    num = 5;
+    assert(7 == array_lower_bound(numbers, &num, number_compare));
+    assert(7 == array_upper_bound(numbers, &num, number_compare));
+    assert(ARRAY_POS_NONE == array_binary_search(numbers, &num, number_compare));
+
+    num = -1;
+    assert(0 == array_lower_bound(numbers, &num, number_compare));
+    assert(ARRAY_POS_NONE == array_binary_search(numbers, &num, number_compare));
+
+    num = 10;
+    assert(10 == array_lower_bound(numbers, &num, number_compare));
+    assert(11 == array_upper_bound(numbers, &num, number_compare));
+    assert(10 == array_binary_search(numbers, &num, number_compare));
+
+    num = 11;
+    assert(11 == array_lower_bound(numbers, &num, number_compare));
+    assert(ARRAY_POS_NONE == array_binary_search(numbers, &num, number_compare));
+
+    /* It should fail when trying to insert an element onto a full sorted array */
+    for (int i = 0; i < 5; i++) {
+        rc = array_insert_sorted(numbers, number_new(1), number_compare);
+        assert(ARRAY_RC_OK == rc);
+    }
+
+    tmp = number_new(1);
+    rc = array_insert_sorted(numbers, tmp, number_compare);
+    assert(ARRAY_RC_FULL == rc && 16 == array_count(numbers));
+    number_destroy(&tmp);
+
+    num = 1;
+    assert(1 == array_lower_bound(numbers, &num, number_compare));
+    assert(6 == array_upper_bound(numbers, &num, number_compare));
+
+    rc = array_destroy(&numbers, number_destroy);
+    assert(ARRAY_RC_OK == rc && NULL == numbers);
+
+    /* End of part 9. */
+
+    /* Part 10. Parallel traversal and reduction */
+
+    const long long zero = 0;
+    long long sum = -1;
+
+    /* It should fail when traversing or reducing a null array */
+    rc = array_parallel_for(NULL, number_double, 4);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_parallel_reduce(NULL, number_sum, number_sum_combine, &zero, sizeof(sum), &sum, 4);
+    assert(ARRAY_RC_NULL == rc && -1 == sum);
+
+    numbers = array_new_growable(0);
+    assert(NULL != numbers);
+
+    /* It should fail when traversing an empty array, and reduce it to the identity value */
+    rc = array_parallel_for(numbers, number_double, 4);
+    assert(ARRAY_RC_EMPTY == rc);
+    rc = array_parallel_reduce(numbers, number_sum, number_sum_combine, &zero, sizeof(sum), &sum,
+                               4);
+    assert(ARRAY_RC_EMPTY == rc && 0 == sum);
+
+    /* Store the numbers wrapped around the end of the ring, so the chunks wrap as well */
+    const int parallel_count = 10 * ARRAY_PARALLEL_MIN_GRAIN + 7;
+
+    for (int i = parallel_count / 2; i < parallel_count; i++)
+        assert(ARRAY_RC_OK == array_push_back(numbers, number_new(i)));
+
+    for (int i = parallel_count / 2 - 1; i >= 0; i--)
+        assert(ARRAY_RC_OK == array_push_front(numbers, number_new(i)));
+
+    assert((size_t)parallel_count == array_count(numbers));
+
+    /* It should fail when no callback function (or no identity or result accumulator) is given */
+    rc = array_parallel_for(numbers, NULL, 4);
+    assert(ARRAY_RC_ELEM_CB_NULL == rc);
+    rc = array_parallel_reduce(numbers, NULL, number_sum_combine, &zero, sizeof(sum), &sum, 4);
+    assert(ARRAY_RC_ELEM_CB_NULL == rc);
+    rc = array_parallel_reduce(numbers, number_sum, NULL, &zero, sizeof(sum), &sum, 4);
+    assert(ARRAY_RC_ELEM_CB_NULL == rc);
+    rc = array_parallel_reduce(numbers, number_sum, number_sum_combine, NULL, sizeof(sum), &sum,
+                               4);
+    assert(ARRAY_RC_ELEM_NULL == rc);
+    rc = array_parallel_reduce(numbers, number_sum, number_sum_combine, &zero, sizeof(sum), NULL,
+                               4);
+    assert(ARRAY_RC_ELEM_NULL == rc);
+
+    /* It should visit every element exactly once, whatever the no. of threads */
+    size_t nthreads[] = { 1, 3, 4, 64, 0 };
+    int factor = 1;
+
+    for (size_t t = 0; t < sizeof(nthreads) / sizeof(nthreads[0]); t++) {
+        rc = array_parallel_for(numbers, number_double, nthreads[t]);
+        assert(ARRAY_RC_OK == rc);
+        factor *= 2;
+
+        for (int i = 0; i < parallel_count; i++)
+            assert(i * factor == *(int *)array_pick_at(numbers, i));
+    }
+
+    /* It should reduce every element exactly once, whatever the no. of threads */
+    long long expected = (long long)parallel_count * (parallel_count - 1) / 2 * factor;
+
+    for (size_t t = 0; t < sizeof(nthreads) / sizeof(nthreads[0]); t++) {
+        sum = -1;
+        rc = array_parallel_reduce(numbers, number_sum, number_sum_combine, &zero, sizeof(sum),
+                                   &sum, nthreads[t]);
+        assert(ARRAY_RC_OK == rc && expected == sum);
+    }
+
+    rc = array_destroy(&numbers, number_destroy);
+    assert(ARRAY_RC_OK == rc && NULL == numbers);
+
+    /* End of part 10. */
+
+    /* Part 11. Positions given as 'size_t' indexes */
+
+    /* It should fail when using indexes on a null array */
+    rc = array_push_at_idx(NULL, &num, 0);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_swap_idx(NULL, 0, 1);
+    assert(ARRAY_RC_NULL == rc);
+    assert(NULL == array_pick_at_idx(NULL, 0));
+    assert(NULL == array_pop_at_idx(NULL, 0));
+    assert(NULL == array_replace_idx(NULL, &num, 0));
+    assert(ARRAY_POS_NONE == array_find_next_idx(NULL, &num, 0, number_compare));
+
+    numbers = array_new(8);
+    assert(NULL != numbers);
+
+    /* It should fail when using invalid indexes, including those beyond INT_MAX */
+    rc = array_swap_idx(numbers, 0, 1);
+    assert(ARRAY_RC_EMPTY == rc);
+    rc = array_push_at_idx(numbers, &num, 1);
+    assert(ARRAY_RC_INVALID_POS == rc);
+    rc = array_push_at_idx(numbers, &num, (size_t)INT_MAX + 1);
+    assert(ARRAY_RC_INVALID_POS == rc);
+    rc = array_push_at_idx(numbers, &num, ARRAY_POS_NONE);
+    assert(ARRAY_RC_INVALID_POS == rc && 0 == array_count(numbers));
+
+    for (size_t i = 0; i < 6; i++) {
+        rc = array_push_at_idx(numbers, number_new((int)i * 10), i / 2);
+        assert(ARRAY_RC_OK == rc && i + 1 == array_count(numbers));
+    }
+
+    assert_numbers(numbers, (const int[]){ 10, 30, 50, 40, 20, 0 }, 6);
+
+    assert(NULL == array_pick_at_idx(numbers, 6));
+    assert(NULL == array_pick_at_idx(numbers, (size_t)INT_MAX + 1));
+    assert(NULL == array_pop_at_idx(numbers, 6));
+    assert(NULL == array_replace_idx(numbers, &num, 6));
+    rc = array_swap_idx(numbers, 0, 6);
+    assert(ARRAY_RC_INVALID_POS == rc);
+    rc = array_swap_idx(numbers, 2, 2);
+    assert(ARRAY_RC_INVALID_POS == rc);
+
+    /* It should behave the same as the 'int' positions API when using valid indexes */
+    rc = array_swap_idx(numbers, 0, 5);
+    assert(ARRAY_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 0, 30, 50, 40, 20, 10 }, 6);
+
+    tmp = array_pop_at_idx(numbers, 2);
+    assert(NULL != tmp && 50 == *(int *)tmp && 5 == array_count(numbers));
+    tmp = array_replace_idx(numbers, tmp, 1);
+    assert(NULL != tmp && 30 == *(int *)tmp);
+    number_destroy(&tmp);
+    assert_numbers(numbers, (const int[]){ 0, 50, 40, 20, 10 }, 5);
+
+    num = 40;
+    assert(2 == array_find_next_idx(numbers, &num, 0, number_compare));
+    assert(2 == array_find_next_idx(numbers, &num, 2, number_compare));
+    assert(ARRAY_POS_NONE == array_find_next_idx(numbers, &num, 3, number_compare));
+    assert(ARRAY_POS_NONE == array_find_next_idx(numbers, &num, 0, NULL));
+    assert(2 == array_find_next(numbers, &num, 0, number_compare));
+    assert(-1 == array_find_next(numbers, &num, -1, number_compare));
+
+    rc = array_destroy(&numbers, number_destroy);
+    assert(ARRAY_RC_OK == rc && NULL == numbers);
+
+    /* End of part 11. */
+
     /* End of all tests. */
 
     return 0;
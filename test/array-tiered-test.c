@@ -0,0 +1,176 @@
+/**
+ * \file   array-tiered-test.c
+ * \brief  Tiered (chunked) array - unit test simulation for basic functions
+ */
+#include <assert.h>
+#include "libdatastructures/array/array-tiered.h"
+#include "number/number.h"
+
+/**
+ * \brief  Assert the tiered array stores exactly the same elements as a plain array, in order.
+ * \param  t  the tiered array whose elements are to be checked
+ * \param  a  the plain array storing the expected elements
+ */
+static void assert_same_elems(array_tiered_s *t, array_s *a)
+{
+    assert(array_count(a) == array_tiered_count(t));
+
+    for (size_t i = 0; i < array_count(a); i++)
+        assert(array_pick_at_idx(a, i) == array_tiered_pick_at(t, i));
+
+    return;
+}
+
+int main(void)
+{
+    array_rc_e rc;
+    void *tmp;
+
+    /* Part 1. Null tiered array */
+    array_tiered_s *numbers = NULL;
+
+    /* It should do nothing when trying to initialize a null array */
+    array_init_tiered(numbers);
+    assert(NULL == numbers);
+
+    /* It should fail when trying to push, traverse, clear or destroy a null array */
+    tmp = number_new(1);
+    rc = array_tiered_push_back(numbers, tmp);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_tiered_push_front(numbers, tmp);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_tiered_push_at(numbers, tmp, 0);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_tiered_traverse(numbers, number_print);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_tiered_clear(numbers, number_destroy);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_tiered_destroy(NULL, number_destroy);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_tiered_destroy(&numbers, number_destroy);
+    assert(ARRAY_RC_NULL == rc);
+
+    /* It should return zero or null when trying to get elements of a null array */
+    assert(0 == array_tiered_count(numbers));
+    assert(NULL == array_tiered_pick_front(numbers));
+    assert(NULL == array_tiered_pick_back(numbers));
+    assert(NULL == array_tiered_pick_at(numbers, 0));
+    assert(NULL == array_tiered_pop_front(numbers));
+    assert(NULL == array_tiered_pop_back(numbers));
+    assert(NULL == array_tiered_pop_at(numbers, 0));
+    assert(NULL == array_tiered_replace(numbers, tmp, 0));
+
+    /* End of part 1. */
+
+    /* Part 2. Empty tiered array */
+
+    numbers = array_new_tiered();
+    assert(NULL != numbers && 0 == array_tiered_count(numbers));
+
+    /* It should fail when trying to get or pop elements of an empty array */
+    assert(NULL == array_tiered_pick_front(numbers));
+    assert(NULL == array_tiered_pick_back(numbers));
+    assert(NULL == array_tiered_pop_at(numbers, 0));
+    assert(NULL == array_tiered_replace(numbers, tmp, 0));
+
+    /* It should fail when trying to push onto an invalid position, traverse or clear it */
+    rc = array_tiered_push_at(numbers, tmp, 1);
+    assert(ARRAY_RC_INVALID_POS == rc && 0 == array_tiered_count(numbers));
+    rc = array_tiered_traverse(numbers, number_print);
+    assert(ARRAY_RC_EMPTY == rc);
+    rc = array_tiered_clear(numbers, number_destroy);
+    assert(ARRAY_RC_EMPTY == rc);
+
+    /* End of part 2. */
+
+    /* Part 3. Non-empty tiered array */
+
+    /* It should keep the pushed elements in order */
+    rc = array_tiered_push_back(numbers, tmp);
+    assert(ARRAY_RC_OK == rc && 1 == array_tiered_count(numbers));
+    rc = array_tiered_push_front(numbers, number_new(0));
+    assert(ARRAY_RC_OK == rc && 2 == array_tiered_count(numbers));
+    rc = array_tiered_push_back(numbers, number_new(3));
+    assert(ARRAY_RC_OK == rc && 3 == array_tiered_count(numbers));
+    rc = array_tiered_push_at(numbers, number_new(2), 2);
+    assert(ARRAY_RC_OK == rc && 4 == array_tiered_count(numbers));
+
+    for (size_t i = 0; i < 4; i++)
+        assert((int)i == *(int *)array_tiered_pick_at(numbers, i));
+
+    assert(0 == *(int *)array_tiered_pick_front(numbers));
+    assert(3 == *(int *)array_tiered_pick_back(numbers));
+    assert(NULL == array_tiered_pick_at(numbers, 4));
+
+    /* It should replace and pop elements */
+    tmp = array_tiered_replace(numbers, number_new(10), 1);
+    assert(NULL != tmp && 1 == *(int *)tmp);
+    number_destroy(&tmp);
+
+    tmp = array_tiered_pop_at(numbers, 1);
+    assert(NULL != tmp && 10 == *(int *)tmp && 3 == array_tiered_count(numbers));
+    number_destroy(&tmp);
+    tmp = array_tiered_pop_front(numbers);
+    assert(NULL != tmp && 0 == *(int *)tmp && 2 == array_tiered_count(numbers));
+    number_destroy(&tmp);
+    tmp = array_tiered_pop_back(numbers);
+    assert(NULL != tmp && 3 == *(int *)tmp && 1 == array_tiered_count(numbers));
+    number_destroy(&tmp);
+    assert(NULL == array_tiered_pop_at(numbers, 1));
+
+    /* It should succeed when traversing and clearing a non-empty array */
+    rc = array_tiered_traverse(numbers, NULL);
+    assert(ARRAY_RC_ELEM_CB_NULL == rc);
+    rc = array_tiered_traverse(numbers, number_print);
+    assert(ARRAY_RC_OK == rc);
+    rc = array_tiered_clear(numbers, number_destroy);
+    assert(ARRAY_RC_OK == rc && 0 == array_tiered_count(numbers));
+
+    /* End of part 3. */
+
+    /* Part 4. Many elements pushed and popped at arbitrary positions */
+
+    array_s *expected = array_new_growable(0);
+    assert(NULL != expected);
+
+    /* It should keep the same order as a plain array while its chunks get longer */
+    for (int i = 0; i < 5000; i++) {
+        size_t pos = (size_t)i * 7919 % ((size_t)i + 1);
+        tmp = number_new(i);
+
+        rc = array_tiered_push_at(numbers, tmp, pos);
+        assert(ARRAY_RC_OK == rc);
+        rc = array_push_at_idx(expected, tmp, pos);
+        assert(ARRAY_RC_OK == rc);
+    }
+
+    assert_same_elems(numbers, expected);
+    assert(numbers->nchunks <= ((size_t)1 << numbers->chunk_shift));
+    assert(4 < numbers->chunk_shift);
+
+    /* It should keep the same order as a plain array while its chunks get shorter */
+    for (int i = 0; i < 4990; i++) {
+        size_t pos = (size_t)i * 104729 % array_count(expected);
+
+        tmp = array_tiered_pop_at(numbers, pos);
+        assert(NULL != tmp && array_pop_at_idx(expected, pos) == tmp);
+        number_destroy(&tmp);
+
+        if (0 == i % 500)
+            assert_same_elems(numbers, expected);
+    }
+
+    assert_same_elems(numbers, expected);
+    assert(4 == numbers->chunk_shift);
+
+    rc = array_destroy(&expected, NULL);
+    assert(ARRAY_RC_ELEM_CB_NULL == rc && NULL == expected);
+    rc = array_tiered_destroy(&numbers, number_destroy);
+    assert(ARRAY_RC_OK == rc && NULL == numbers);
+
+    /* End of part 4. */
+
+    /* End of all tests. */
+
+    return 0;
+}
@@ -0,0 +1,218 @@
+/**
+ * \file   array-typed-test.c
+ * \brief  Typed (value) array - unit test simulation for basic functions
+ */
+#include <assert.h>
+#include "libdatastructures/array/array-typed.h"
+#include "number/number.h"
+
+/** A small 'plain old data' structure to be stored inline in a typed array */
+struct point {
+    double x;
+    double y;
+};
+
+int main(void)
+{
+    array_rc_e rc;
+    void *tmp;
+    int num;
+
+    /* Part 1. Null typed array */
+    array_typed_s *numbers = NULL;
+
+    /* It should do nothing when trying to initialize a null array */
+    array_init_typed(numbers, sizeof(int), 5);
+    assert(NULL == numbers);
+
+    /* It should not create an array of zero-sized elements */
+    numbers = array_new_typed(0, 5);
+    assert(NULL == numbers);
+
+    /* It should fail when trying to push, pop, traverse or reserve a null array */
+    num = 1;
+    rc = array_typed_push_back(numbers, &num);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_typed_push_front(numbers, &num);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_typed_push_at(numbers, &num, 0);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_typed_pop_back(numbers, &num);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_typed_pop_front(numbers, &num);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_typed_pop_at(numbers, 0, &num);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_typed_traverse(numbers, number_print);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_typed_reserve(numbers, 10);
+    assert(ARRAY_RC_NULL == rc);
+
+    /* It should return zero or null when trying to get the elements of a null array */
+    assert(0 == array_typed_count(numbers));
+    assert(NULL == array_typed_data(numbers));
+    assert(NULL == array_typed_pick_front(numbers));
+    assert(NULL == array_typed_pick_back(numbers));
+    assert(NULL == array_typed_pick_at(numbers, 0));
+
+    /* It should fail when trying to clear or destroy a null array */
+    rc = array_typed_clear(numbers);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_typed_destroy(NULL);
+    assert(ARRAY_RC_NULL == rc);
+    rc = array_typed_destroy(&numbers);
+    assert(ARRAY_RC_NULL == rc);
+
+    /* End of part 1. */
+
+    /* Part 2. Empty typed array */
+
+    numbers = array_new_typed(sizeof(int), 0);
+    assert(NULL != numbers && 0 == array_typed_count(numbers) && sizeof(int) == numbers->elem_size);
+
+    /* It should fail when trying to pop or get elements of an empty array */
+    rc = array_typed_pop_back(numbers, &num);
+    assert(ARRAY_RC_EMPTY == rc);
+    rc = array_typed_pop_at(numbers, 0, NULL);
+    assert(ARRAY_RC_EMPTY == rc);
+    assert(NULL == array_typed_data(numbers));
+    assert(NULL == array_typed_pick_at(numbers, 0));
+
+    /* It should fail when trying to traverse or clear an empty array */
+    rc = array_typed_traverse(numbers, number_print);
+    assert(ARRAY_RC_EMPTY == rc);
+    rc = array_typed_clear(numbers);
+    assert(ARRAY_RC_EMPTY == rc);
+
+    /* End of part 2. */
+
+    /* Part 3. Non-empty typed array */
+
+    /* It should fail when trying to push a null element or onto an invalid position */
+    rc = array_typed_push_back(numbers, NULL);
+    assert(ARRAY_RC_ELEM_NULL == rc && 0 == array_typed_count(numbers));
+    rc = array_typed_push_at(numbers, &num, 1);
+    assert(ARRAY_RC_INVALID_POS == rc && 0 == array_typed_count(numbers));
+
+    /* It should copy the elements onto the array, growing it as needed */
+    for (num = 0; num < 100; num++) {
+        rc = array_typed_push_back(numbers, &num);
+        assert(ARRAY_RC_OK == rc && (size_t)num + 1 == array_typed_count(numbers));
+    }
+
+    num = -1;
+    rc = array_typed_push_front(numbers, &num);
+    assert(ARRAY_RC_OK == rc && 101 == array_typed_count(numbers));
+    num = -2;
+    rc = array_typed_push_at(numbers, &num, 50);
+    assert(ARRAY_RC_OK == rc && 102 == array_typed_count(numbers));
+
+    /* It should store the elements contiguously */
+    int *data = (int *)array_typed_data(numbers);
+    assert(NULL != data && -1 == data[0] && 48 == data[49] && -2 == data[50] && 49 == data[51]);
+    assert(99 == data[101]);
+
+    tmp = array_typed_pick_front(numbers);
+    assert(NULL != tmp && -1 == *(int *)tmp);
+    tmp = array_typed_pick_back(numbers);
+    assert(NULL != tmp && 99 == *(int *)tmp);
+    tmp = array_typed_pick_at(numbers, 50);
+    assert(NULL != tmp && -2 == *(int *)tmp);
+    tmp = array_typed_pick_at(numbers, 102);
+    assert(NULL == tmp);
+
+    /* It should copy the popped elements out of the array */
+    rc = array_typed_pop_at(numbers, 50, &num);
+    assert(ARRAY_RC_OK == rc && -2 == num && 101 == array_typed_count(numbers));
+    rc = array_typed_pop_front(numbers, &num);
+    assert(ARRAY_RC_OK == rc && -1 == num && 100 == array_typed_count(numbers));
+    rc = array_typed_pop_back(numbers, &num);
+    assert(ARRAY_RC_OK == rc && 99 == num && 99 == array_typed_count(numbers));
+    rc = array_typed_pop_back(numbers, NULL);
+    assert(ARRAY_RC_OK == rc && 98 == array_typed_count(numbers));
+    rc = array_typed_pop_at(numbers, 98, &num);
+    assert(ARRAY_RC_INVALID_POS == rc && 98 == array_typed_count(numbers));
+
+    for (size_t i = 0; i < array_typed_count(numbers); i++)
+        assert((int)i == *(int *)array_typed_pick_at(numbers, i));
+
+    /* It should succeed when traversing a non-empty array */
+    rc = array_typed_traverse(numbers, NULL);
+    assert(ARRAY_RC_ELEM_CB_NULL == rc);
+    rc = array_typed_traverse(numbers, number_print);
+    assert(ARRAY_RC_OK == rc);
+
+    /* It should succeed when clearing and destroying a non-empty array */
+    rc = array_typed_clear(numbers);
+    assert(ARRAY_RC_OK == rc && 0 == array_typed_count(numbers));
+    rc = array_typed_push_back(numbers, &num);
+    assert(ARRAY_RC_OK == rc && 1 == array_typed_count(numbers));
+    rc = array_typed_destroy(&numbers);
+    assert(ARRAY_RC_OK == rc && NULL == numbers);
+
+    /* End of part 3. */
+
+    /* Part 4. Typed array of structures */
+
+    array_typed_s *points = array_new_typed(sizeof(struct point), 16);
+    assert(NULL != points && 16 <= points->length);
+
+    /* It should not reallocate the storage when the reserved length is enough */
+    rc = array_typed_reserve(points, 8);
+    assert(ARRAY_RC_OK == rc && 16 == points->length);
+
+    void *storage = points->elems;
+
+    for (int i = 0; i < 16; i++) {
+        struct point p = { (double)i, (double)-i };
+        rc = array_typed_push_back(points, &p);
+        assert(ARRAY_RC_OK == rc);
+    }
+
+    assert(storage == points->elems && 16 == array_typed_count(points));
+
+    struct point p;
+    rc = array_typed_pop_at(points, 3, &p);
+    assert(ARRAY_RC_OK == rc && 3.0 == p.x && -3.0 == p.y);
+    assert(4.0 == ((struct point *)array_typed_pick_at(points, 3))->x);
+
+    rc = array_typed_destroy(&points);
+    assert(ARRAY_RC_OK == rc && NULL == points);
+
+    /* End of part 4. */
+
+    /* Part 5. Pushing an element picked from the same typed array */
+
+    numbers = array_new_typed(sizeof(int), 4);
+    assert(NULL != numbers);
+
+    for (num = 0; num < 4; num++) {
+        rc = array_typed_push_back(numbers, &num);
+        assert(ARRAY_RC_OK == rc);
+    }
+
+    /* It should copy the element even when the array is full and thus reallocated */
+    assert(array_typed_count(numbers) == numbers->length);
+    rc = array_typed_push_back(numbers, array_typed_pick_at(numbers, 0));
+    assert(ARRAY_RC_OK == rc && 5 == array_typed_count(numbers));
+
+    /* It should copy the element even when it is shifted to make room for the copy */
+    assert(array_typed_count(numbers) < numbers->length);
+    rc = array_typed_push_at(numbers, array_typed_pick_at(numbers, 3), 1);
+    assert(ARRAY_RC_OK == rc && 6 == array_typed_count(numbers));
+    rc = array_typed_push_front(numbers, array_typed_pick_back(numbers));
+    assert(ARRAY_RC_OK == rc && 7 == array_typed_count(numbers));
+
+    data = (int *)array_typed_data(numbers);
+    assert(0 == data[0] && 0 == data[1] && 3 == data[2] && 1 == data[3] && 2 == data[4]);
+    assert(3 == data[5] && 0 == data[6]);
+
+    rc = array_typed_destroy(&numbers);
+    assert(ARRAY_RC_OK == rc && NULL == numbers);
+
+    /* End of part 5. */
+
+    /* End of all tests. */
+
+    return 0;
+}
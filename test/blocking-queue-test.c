@@ -0,0 +1,247 @@
+/**
+ * \file   blocking-queue-test.c
+ * \brief  Blocking bounded queue - unit test simulation for basic functions
+ */
+#include <assert.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+#include "libdatastructures/queue/blocking-queue.h"
+#include "number/number.h"
+
+/** No. of producer threads (and of consumer ones) */
+#define NTHREADS 4
+
+/** No. of elements enqueued by every producer thread */
+#define NELEMS 2000
+
+/** No. of elements dequeued at once by the consumer threads */
+#define BATCH 8
+
+/** The queue shared by the producer and consumer threads */
+static blocking_queue_s *shared;
+
+/** The elements enqueued by the producers */
+static int elems[NTHREADS * NELEMS];
+
+/** No. of times every element has been dequeued */
+static atomic_int dequeued[NTHREADS * NELEMS];
+
+/**
+ * \brief   Get the (monotonic clock) time elapsed since a given time, in milliseconds.
+ * \param   start  the given time
+ * \return  the time elapsed since then
+ */
+static long elapsed_ms(const struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (now.tv_sec - start->tv_sec) * 1000L + (now.tv_nsec - start->tv_nsec) / 1000000L;
+}
+
+/**
+ * \brief   Enqueue the elements of a producer, waiting for room while the queue is full.
+ * \param   arg  pointer to the first element of the producer
+ * \return  null
+ */
+static void *producer_run(void *arg)
+{
+    int *first = (int *)arg;
+
+    for (int i = 0; i < NELEMS; i++) {
+        blocking_queue_rc_e rc = blocking_queue_enqueue(shared, &first[i],
+                                                        BLOCKING_QUEUE_WAIT_FOREVER);
+        assert(BLOCKING_QUEUE_RC_OK == rc);
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief   Dequeue elements in batches, waiting for them, until the queue is closed and empty.
+ * \param   arg  unused
+ * \return  null
+ */
+static void *consumer_run(void *arg)
+{
+    void *batch[BATCH];
+    size_t n;
+
+    (void)arg;
+
+    while (0 < (n = blocking_queue_dequeue_batch(shared, batch, BATCH,
+                                                 BLOCKING_QUEUE_WAIT_FOREVER))) {
+        for (size_t i = 0; i < n; i++)
+            atomic_fetch_add(&dequeued[*(int *)batch[i]], 1);
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    blocking_queue_rc_e rc;
+    void *tmp = NULL;
+    void *batch[BATCH];
+    struct timespec start;
+
+    /* Part 1. Null queue */
+    blocking_queue_s *numbers = NULL;
+
+    /* It should do nothing when trying to initialize a null queue */
+    blocking_queue_init(numbers, 4);
+    assert(NULL == numbers);
+
+    /* It should fail when trying to enqueue an element into a null queue */
+    void *dummy = number_new(0);
+    rc = blocking_queue_enqueue(numbers, dummy, 0);
+    assert(BLOCKING_QUEUE_RC_NULL == rc);
+
+    /* It should return null when trying to dequeue elements off a null queue */
+    tmp = blocking_queue_dequeue(numbers, 0);
+    assert(NULL == tmp);
+    assert(0 == blocking_queue_dequeue_batch(numbers, batch, BATCH, 0));
+    assert(0 == blocking_queue_count(numbers));
+
+    /* It should fail when trying to close, empty or destroy a null queue */
+    rc = blocking_queue_close(numbers);
+    assert(BLOCKING_QUEUE_RC_NULL == rc);
+    rc = blocking_queue_clear(numbers, number_destroy);
+    assert(BLOCKING_QUEUE_RC_NULL == rc);
+    rc = blocking_queue_destroy(NULL, number_destroy);
+    assert(BLOCKING_QUEUE_RC_NULL == rc);
+    rc = blocking_queue_destroy(&numbers, number_destroy);
+    assert(BLOCKING_QUEUE_RC_NULL == rc);
+
+    /* End of part 1. */
+
+    /* Part 2. Empty queue */
+    numbers = blocking_queue_new(4);
+    assert(NULL != numbers && 0 == blocking_queue_count(numbers));
+
+    /* It should fail when trying to enqueue a null element */
+    rc = blocking_queue_enqueue(numbers, NULL, 0);
+    assert(BLOCKING_QUEUE_RC_ELEM_NULL == rc);
+
+    /* It should return null at once when not allowed to wait for an element */
+    tmp = blocking_queue_dequeue(numbers, 0);
+    assert(NULL == tmp);
+
+    /* It should return null after the timeout when waiting for an element in vain */
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    tmp = blocking_queue_dequeue(numbers, 20);
+    assert(NULL == tmp && elapsed_ms(&start) >= 20);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    assert(0 == blocking_queue_dequeue_batch(numbers, batch, BATCH, 20));
+    assert(elapsed_ms(&start) >= 20);
+
+    /* End of part 2. */
+
+    /* Part 3. Non-empty queue */
+
+    /* It should succeed when enqueueing elements until the queue gets full */
+    for (int i = 0; i < 4; i++) {
+        rc = blocking_queue_enqueue(numbers, number_new(i), 0);
+        assert(BLOCKING_QUEUE_RC_OK == rc && (size_t)i + 1 == blocking_queue_count(numbers));
+    }
+
+    /* It should fail at once, or after the timeout, when enqueueing into a full queue */
+    rc = blocking_queue_enqueue(numbers, dummy, 0);
+    assert(BLOCKING_QUEUE_RC_FULL == rc);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    rc = blocking_queue_enqueue(numbers, dummy, 20);
+    assert(BLOCKING_QUEUE_RC_TIMEOUT == rc && elapsed_ms(&start) >= 20);
+
+    /* It should dequeue the elements in order, singly or many at once */
+    tmp = blocking_queue_dequeue(numbers, BLOCKING_QUEUE_WAIT_FOREVER);
+    assert(NULL != tmp && 0 == *(int *)tmp && 3 == blocking_queue_count(numbers));
+    number_destroy(&tmp);
+
+    assert(2 == blocking_queue_dequeue_batch(numbers, batch, 2, 0));
+    assert(1 == *(int *)batch[0] && 2 == *(int *)batch[1] && 1 == blocking_queue_count(numbers));
+    number_destroy(&batch[0]);
+    number_destroy(&batch[1]);
+
+    /* It should fail to enqueue an element into a closed queue, whose elements remain */
+    rc = blocking_queue_close(numbers);
+    assert(BLOCKING_QUEUE_RC_OK == rc);
+    rc = blocking_queue_enqueue(numbers, dummy, BLOCKING_QUEUE_WAIT_FOREVER);
+    assert(BLOCKING_QUEUE_RC_CLOSED == rc);
+
+    assert(1 == blocking_queue_dequeue_batch(numbers, batch, BATCH, BLOCKING_QUEUE_WAIT_FOREVER));
+    assert(3 == *(int *)batch[0]);
+    number_destroy(&batch[0]);
+
+    /* It shouldn't wait for elements on a closed and empty queue */
+    tmp = blocking_queue_dequeue(numbers, BLOCKING_QUEUE_WAIT_FOREVER);
+    assert(NULL == tmp);
+
+    rc = blocking_queue_destroy(&numbers, number_destroy);
+    assert(BLOCKING_QUEUE_RC_EMPTY == rc && NULL == numbers);
+
+    /* An unbounded queue should never be full */
+    numbers = blocking_queue_new(0);
+    assert(NULL != numbers);
+
+    for (int i = 0; i < 100; i++) {
+        rc = blocking_queue_enqueue(numbers, number_new(i), 0);
+        assert(BLOCKING_QUEUE_RC_OK == rc);
+    }
+
+    rc = blocking_queue_enqueue(numbers, dummy, 0);
+    assert(BLOCKING_QUEUE_RC_OK == rc && 101 == blocking_queue_count(numbers));
+
+    /* It should succeed at removing all elements from the queue, handing them to the callback */
+    rc = blocking_queue_clear(numbers, number_destroy);
+    assert(BLOCKING_QUEUE_RC_OK == rc && 0 == blocking_queue_count(numbers));
+
+    rc = blocking_queue_destroy(&numbers, number_destroy);
+    assert(BLOCKING_QUEUE_RC_EMPTY == rc && NULL == numbers);
+
+    /* End of part 3. */
+
+    /* Part 4. Queue shared by many producer and consumer threads */
+    pthread_t producers[NTHREADS];
+    pthread_t consumers[NTHREADS];
+
+    shared = blocking_queue_new(16);
+    assert(NULL != shared);
+
+    for (int i = 0; i < NTHREADS * NELEMS; i++) {
+        elems[i] = i;
+        atomic_init(&dequeued[i], 0);
+    }
+
+    for (int i = 0; i < NTHREADS; i++) {
+        int err = pthread_create(&consumers[i], NULL, consumer_run, NULL);
+        assert(0 == err);
+        err = pthread_create(&producers[i], NULL, producer_run, &elems[i * NELEMS]);
+        assert(0 == err);
+    }
+
+    for (int i = 0; i < NTHREADS; i++)
+        pthread_join(producers[i], NULL);
+
+    /* Closing the queue should wake the consumers up once they've dequeued all the elements */
+    rc = blocking_queue_close(shared);
+    assert(BLOCKING_QUEUE_RC_OK == rc);
+
+    for (int i = 0; i < NTHREADS; i++)
+        pthread_join(consumers[i], NULL);
+
+    for (int i = 0; i < NTHREADS * NELEMS; i++)
+        assert(1 == atomic_load(&dequeued[i]));
+
+    rc = blocking_queue_destroy(&shared, NULL);
+    assert(BLOCKING_QUEUE_RC_EMPTY == rc && NULL == shared);
+
+    /* End of part 4. */
+
+    /* End of all tests. */
+
+    return 0;
+}
@@ -0,0 +1,192 @@
+/**
+ * \file   concurrent-stack-test.c
+ * \brief  Lock-free bounded stack (Treiber stack) - unit test simulation for basic functions
+ */
+#include <assert.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "libdatastructures/stack/concurrent-stack.h"
+#include "number/number.h"
+
+/** No. of threads pushing onto and popping from the shared stack */
+#define NTHREADS 16
+
+/** No. of elements pushed by every thread */
+#define NELEMS 2000
+
+/** The stack shared by the threads */
+static concurrent_stack_s *shared;
+
+/** The elements pushed by the threads: the j-th one of the i-th thread is 'i * NELEMS + j' */
+static int elems[NTHREADS * NELEMS];
+
+/** No. of times every element has been popped */
+static atomic_int popped[NTHREADS * NELEMS];
+
+/**
+ * \brief   Push the elements of a thread, popping an element after every second one pushed.
+ * \param   arg  pointer to the first element of the thread
+ * \return  null
+ */
+static void *thread_run(void *arg)
+{
+    int *first = (int *)arg;
+
+    for (int i = 0; i < NELEMS; i++) {
+        concurrent_stack_rc_e rc = concurrent_stack_push(shared, &first[i]);
+        assert(CONCURRENT_STACK_RC_OK == rc);
+
+        /* Every thread has pushed more elements than it has popped, so the stack isn't empty */
+        if (1 == i % 2) {
+            int *elem = (int *)concurrent_stack_pop(shared);
+            assert(NULL != elem);
+            atomic_fetch_add(&popped[*elem], 1);
+        }
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    concurrent_stack_rc_e rc;
+    void *tmp = NULL;
+
+    /* Part 1. Null stack */
+    concurrent_stack_s *numbers = NULL;
+
+    /* It should do nothing when trying to initialize a null stack */
+    concurrent_stack_init(numbers, 4, 0);
+    assert(NULL == numbers);
+
+    /* It should fail when trying to push an element onto a null stack */
+    void *dummy = number_new(0);
+    rc = concurrent_stack_push(numbers, dummy);
+    assert(CONCURRENT_STACK_RC_NULL == rc);
+
+    /* It should return null when trying to pop an element off a null stack */
+    tmp = concurrent_stack_pop(numbers);
+    assert(NULL == tmp);
+
+    /* It should return zero when getting the number of elements or capacity of a null stack */
+    assert(0 == concurrent_stack_count(numbers) && 0 == concurrent_stack_capacity(numbers));
+
+    /* It should fail when trying to empty or destroy a null stack */
+    rc = concurrent_stack_clear(numbers, number_destroy);
+    assert(CONCURRENT_STACK_RC_NULL == rc);
+    rc = concurrent_stack_destroy(NULL, number_destroy);
+    assert(CONCURRENT_STACK_RC_NULL == rc);
+    rc = concurrent_stack_destroy(&numbers, number_destroy);
+    assert(CONCURRENT_STACK_RC_NULL == rc);
+
+    /* End of part 1. */
+
+    /* Part 2. Empty stack */
+
+    /* A stack without capacity should always be full */
+    numbers = concurrent_stack_new(0, 0);
+    assert(NULL != numbers && 0 == concurrent_stack_capacity(numbers));
+    rc = concurrent_stack_push(numbers, dummy);
+    assert(CONCURRENT_STACK_RC_FULL == rc && 0 == concurrent_stack_count(numbers));
+    rc = concurrent_stack_destroy(&numbers, number_destroy);
+    assert(CONCURRENT_STACK_RC_EMPTY == rc && NULL == numbers);
+
+    numbers = concurrent_stack_new(8, 4);
+    assert(NULL != numbers && 8 == concurrent_stack_capacity(numbers));
+    assert(0 == concurrent_stack_count(numbers));
+
+    /* It should fail when trying to push a null element */
+    rc = concurrent_stack_push(numbers, NULL);
+    assert(CONCURRENT_STACK_RC_ELEM_NULL == rc && 0 == concurrent_stack_count(numbers));
+
+    /* It should return null when trying to pop an element off an empty stack */
+    tmp = concurrent_stack_pop(numbers);
+    assert(NULL == tmp);
+
+    /* It should return 'empty stack' when trying to empty an empty stack */
+    rc = concurrent_stack_clear(numbers, number_destroy);
+    assert(CONCURRENT_STACK_RC_EMPTY == rc);
+
+    /* End of part 2. */
+
+    /* Part 3. Non-empty stack */
+
+    /* It should succeed when pushing elements until the stack gets full */
+    for (int i = 0; i < 8; i++) {
+        rc = concurrent_stack_push(numbers, number_new(i));
+        assert(CONCURRENT_STACK_RC_OK == rc && (size_t)i + 1 == concurrent_stack_count(numbers));
+    }
+
+    /* It should fail when trying to push an element onto a full stack */
+    rc = concurrent_stack_push(numbers, dummy);
+    assert(CONCURRENT_STACK_RC_FULL == rc && 8 == concurrent_stack_count(numbers));
+
+    /* It should pop the elements in reverse order, recycling their nodes */
+    for (int i = 7; i >= 4; i--) {
+        tmp = concurrent_stack_pop(numbers);
+        assert(NULL != tmp && i == *(int *)tmp && (size_t)i == concurrent_stack_count(numbers));
+        number_destroy(&tmp);
+    }
+
+    for (int i = 4; i < 8; i++) {
+        rc = concurrent_stack_push(numbers, number_new(i * 10));
+        assert(CONCURRENT_STACK_RC_OK == rc);
+    }
+
+    rc = concurrent_stack_push(numbers, dummy);
+    assert(CONCURRENT_STACK_RC_FULL == rc && 8 == concurrent_stack_count(numbers));
+
+    tmp = concurrent_stack_pop(numbers);
+    assert(NULL != tmp && 70 == *(int *)tmp);
+    number_destroy(&tmp);
+
+    /* It should succeed at removing all elements from the stack, handing them to the callback */
+    rc = concurrent_stack_clear(numbers, number_destroy);
+    assert(CONCURRENT_STACK_RC_OK == rc && 0 == concurrent_stack_count(numbers));
+
+    rc = concurrent_stack_push(numbers, dummy);
+    assert(CONCURRENT_STACK_RC_OK == rc);
+    rc = concurrent_stack_destroy(&numbers, number_destroy);
+    assert(CONCURRENT_STACK_RC_OK == rc && NULL == numbers);
+
+    /* End of part 3. */
+
+    /* Part 4. Stack shared by many threads, with and without an elimination array */
+    pthread_t threads[NTHREADS];
+
+    for (size_t nslots = 0; nslots <= 4; nslots += 4) {
+        shared = concurrent_stack_new(NTHREADS * NELEMS, nslots);
+        assert(NULL != shared);
+
+        for (int i = 0; i < NTHREADS * NELEMS; i++) {
+            elems[i] = i;
+            atomic_init(&popped[i], 0);
+        }
+
+        for (int i = 0; i < NTHREADS; i++) {
+            int err = pthread_create(&threads[i], NULL, thread_run, &elems[i * NELEMS]);
+            assert(0 == err);
+        }
+
+        for (int i = 0; i < NTHREADS; i++)
+            pthread_join(threads[i], NULL);
+
+        /* Half the elements should remain, and every element should be popped exactly once */
+        assert(NTHREADS * NELEMS / 2 == concurrent_stack_count(shared));
+
+        while (NULL != (tmp = concurrent_stack_pop(shared)))
+            atomic_fetch_add(&popped[*(int *)tmp], 1);
+
+        for (int i = 0; i < NTHREADS * NELEMS; i++)
+            assert(1 == atomic_load(&popped[i]));
+
+        rc = concurrent_stack_destroy(&shared, NULL);
+        assert(CONCURRENT_STACK_RC_EMPTY == rc && NULL == shared);
+    }
+
+    /* End of part 4. */
+
+    /* End of all tests. */
+
+    return 0;
+}
@@ -109,29 +109,29 @@ int main(void)
 
     /* It must succeed when pushing 8 numbers onto the deque, 4 at front and 4 at back */
     rc = deque_push_back(numbers, number_new(5));
-    assert(DEQUE_RC_OK == rc && NULL != numbers->front && 1 == deque_count(numbers) &&
-           5 == *(int *)numbers->front->elem);
+    assert(DEQUE_RC_OK == rc && 1 == deque_count(numbers) &&
+           5 == *(int *)deque_pick_front(numbers));
     rc = deque_push_front(numbers, number_new(4));
-    assert(DEQUE_RC_OK == rc && NULL != numbers->front && 2 == deque_count(numbers) &&
-           4 == *(int *)numbers->front->elem);
+    assert(DEQUE_RC_OK == rc && 2 == deque_count(numbers) &&
+           4 == *(int *)deque_pick_front(numbers));
     rc = deque_push_back(numbers, number_new(6));
-    assert(DEQUE_RC_OK == rc && NULL != numbers->front && 3 == deque_count(numbers) &&
-           4 == *(int *)numbers->front->elem);
+    assert(DEQUE_RC_OK == rc && 3 == deque_count(numbers) &&
+           4 == *(int *)deque_pick_front(numbers));
     rc = deque_push_front(numbers, number_new(3));
-    assert(DEQUE_RC_OK == rc && NULL != numbers->front && 4 == deque_count(numbers) &&
-           3 == *(int *)numbers->front->elem);
+    assert(DEQUE_RC_OK == rc && 4 == deque_count(numbers) &&
+           3 == *(int *)deque_pick_front(numbers));
     rc = deque_push_back(numbers, number_new(7));
-    assert(DEQUE_RC_OK == rc && NULL != numbers->front && 5 == deque_count(numbers) &&
-           3 == *(int *)numbers->front->elem);
+    assert(DEQUE_RC_OK == rc && 5 == deque_count(numbers) &&
+           3 == *(int *)deque_pick_front(numbers));
     rc = deque_push_front(numbers, number_new(2));
-    assert(DEQUE_RC_OK == rc && NULL != numbers->front && 6 == deque_count(numbers) &&
-           2 == *(int *)numbers->front->elem);
+    assert(DEQUE_RC_OK == rc && 6 == deque_count(numbers) &&
+           2 == *(int *)deque_pick_front(numbers));
     rc = deque_push_back(numbers, number_new(8));
-    assert(DEQUE_RC_OK == rc && NULL != numbers->front && 7 == deque_count(numbers) &&
-           2 == *(int *)numbers->front->elem);
+    assert(DEQUE_RC_OK == rc && 7 == deque_count(numbers) &&
+           2 == *(int *)deque_pick_front(numbers));
     rc = deque_push_front(numbers, number_new(1));
-    assert(DEQUE_RC_OK == rc && NULL != numbers->front && 8 == deque_count(numbers) &&
-           1 == *(int *)numbers->front->elem);
+    assert(DEQUE_RC_OK == rc && 8 == deque_count(numbers) &&
+           1 == *(int *)deque_pick_front(numbers));
 
     /* It should fail when trying to traverse the deque without a callback function provided */
     rc = deque_traverse(numbers, NULL);
@@ -151,23 +151,23 @@ int main(void)
 
     /* It should succeed at popping two elements from the front of the deque */
     tmp = deque_pop_front(numbers);
-    assert(NULL != numbers->front && 7 == deque_count(numbers) && NULL != tmp && 1 == *(int *)tmp);
+    assert(7 == deque_count(numbers) && NULL != tmp && 1 == *(int *)tmp);
     number_print(tmp);
     number_destroy(&tmp);
 
     tmp = deque_pop_front(numbers);
-    assert(NULL != numbers->front && 6 == deque_count(numbers) && NULL != tmp && 2 == *(int *)tmp);
+    assert(6 == deque_count(numbers) && NULL != tmp && 2 == *(int *)tmp);
     number_print(tmp);
     number_destroy(&tmp);
 
     /* It should succeed at popping two elements from the back of the deque */
     tmp = deque_pop_back(numbers);
-    assert(NULL != numbers->front && 5 == deque_count(numbers) && NULL != tmp && 8 == *(int *)tmp);
+    assert(5 == deque_count(numbers) && NULL != tmp && 8 == *(int *)tmp);
     number_print(tmp);
     number_destroy(&tmp);
 
     tmp = deque_pop_back(numbers);
-    assert(NULL != numbers->front && 4 == deque_count(numbers) && NULL != tmp && 7 == *(int *)tmp);
+    assert(4 == deque_count(numbers) && NULL != tmp && 7 == *(int *)tmp);
     number_print(tmp);
     number_destroy(&tmp);
 
@@ -177,37 +177,37 @@ int main(void)
 
     /* It should succeed at popping the remaining 4 elements (deque should be empty) */
     tmp = deque_pop_front(numbers);
-    assert(NULL != numbers->front && 3 == deque_count(numbers) && NULL != tmp && 3 == *(int *)tmp);
+    assert(3 == deque_count(numbers) && NULL != tmp && 3 == *(int *)tmp);
     number_print(tmp);
     number_destroy(&tmp);
 
     tmp = deque_pop_back(numbers);
-    assert(NULL != numbers->front && 2 == deque_count(numbers) && NULL != tmp && 6 == *(int *)tmp);
+    assert(2 == deque_count(numbers) && NULL != tmp && 6 == *(int *)tmp);
     number_print(tmp);
     number_destroy(&tmp);
 
     tmp = deque_pop_back(numbers);
-    assert(NULL != numbers->front && 1 == deque_count(numbers) && NULL != tmp && 5 == *(int *)tmp);
+    assert(1 == deque_count(numbers) && NULL != tmp && 5 == *(int *)tmp);
     number_print(tmp);
     number_destroy(&tmp);
 
     tmp = deque_pop_front(numbers);
-    assert(NULL == numbers->front && 0 == deque_count(numbers) && NULL != tmp && 4 == *(int *)tmp);
+    assert(0 == deque_count(numbers) && NULL != tmp && 4 == *(int *)tmp);
     number_print(tmp);
     number_destroy(&tmp);
 
     tmp = deque_pop_front(numbers);
-    assert(NULL == numbers->front && 0 == deque_count(numbers) && NULL == tmp);
+    assert(0 == deque_count(numbers) && NULL == tmp);
 
     /* Pushing 4 elements again */
     rc = deque_push_front(numbers, number_new(8));
-    assert(DEQUE_RC_OK == rc && NULL != numbers->front && 1 == deque_count(numbers));
+    assert(DEQUE_RC_OK == rc && 1 == deque_count(numbers));
     rc = deque_push_back(numbers, number_new(9));
-    assert(DEQUE_RC_OK == rc && NULL != numbers->front && 2 == deque_count(numbers));
+    assert(DEQUE_RC_OK == rc && 2 == deque_count(numbers));
     rc = deque_push_front(numbers, number_new(7));
-    assert(DEQUE_RC_OK == rc && NULL != numbers->front && 3 == deque_count(numbers));
+    assert(DEQUE_RC_OK == rc && 3 == deque_count(numbers));
     rc = deque_push_back(numbers, number_new(10));
-    assert(DEQUE_RC_OK == rc && NULL != numbers->front && 4 == deque_count(numbers));
+    assert(DEQUE_RC_OK == rc && 4 == deque_count(numbers));
 
     /* It should fail when trying to traverse the deque without a callback function provided */
     rc = deque_traverse(numbers, NULL);
@@ -219,12 +219,139 @@ int main(void)
 
     /* It should succeed at removing all elements from the deque (deque must be empty) */
     rc = deque_clear(numbers, number_destroy);
-    assert(DEQUE_RC_OK == rc && NULL == numbers->front && 0 == deque_count(numbers));
+    assert(DEQUE_RC_OK == rc && 0 == deque_count(numbers));
 
     /* It should return 'deque empty' after destroying the deque */
     rc = deque_destroy(&numbers, number_destroy);
     assert(DEQUE_RC_EMPTY == rc);
 
+    /* Part 4. Deque with a node pool shared with another deque */
+
+    numbers = deque_new();
+    deque_s *others = deque_new();
+    node_pool_s *pool = node_pool_new(DEQUE_BLOCK_LENGTH * sizeof(void *), 4);
+    node_pool_s *small_pool = node_pool_new(sizeof(void *), 4);
+    assert(NULL != numbers && NULL != others && NULL != pool && NULL != small_pool);
+
+    /* It should fail when setting the pool of a null deque */
+    rc = deque_set_pool(NULL, pool);
+    assert(DEQUE_RC_NULL == rc);
+
+    /* It should fail when setting a pool whose nodes are too small to store the deque blocks */
+    rc = deque_set_pool(numbers, small_pool);
+    assert(DEQUE_RC_INVALID_POOL == rc);
+    node_pool_destroy(&small_pool);
+
+    rc = deque_set_pool(numbers, pool);
+    assert(DEQUE_RC_OK == rc);
+    rc = deque_set_pool(others, pool);
+    assert(DEQUE_RC_OK == rc);
+
+    /* It should allocate the blocks of both deques out of the shared pool */
+    for (int i = 0; i <= DEQUE_BLOCK_LENGTH; i++) {
+        rc = deque_push_back(numbers, number_new(i));
+        assert(DEQUE_RC_OK == rc);
+    }
+
+    for (int i = 0; i < 4; i++) {
+        rc = deque_push_back(others, number_new(i));
+        assert(DEQUE_RC_OK == rc);
+    }
+
+    assert(3 == node_pool_count(pool));
+
+    /* It should fail when trying to change the pool of a non-empty deque */
+    rc = deque_set_pool(numbers, NULL);
+    assert(DEQUE_RC_NOT_EMPTY == rc);
+
+    /* It should keep the emptied first block as a spare one, reusing it for a new first block */
+    for (int i = 0; i < DEQUE_BLOCK_LENGTH; i++) {
+        tmp = deque_pop_front(numbers);
+        assert(NULL != tmp && i == *(int *)tmp);
+        number_destroy(&tmp);
+    }
+
+    assert(1 == deque_count(numbers) && 3 == node_pool_count(pool));
+    rc = deque_push_front(numbers, number_new(-1));
+    assert(DEQUE_RC_OK == rc && 3 == node_pool_count(pool));
+
+    rc = deque_destroy(&numbers, number_destroy);
+    assert(DEQUE_RC_OK == rc && 1 == node_pool_count(pool));
+    rc = deque_destroy(&others, number_destroy);
+    assert(DEQUE_RC_OK == rc && 0 == node_pool_count(pool));
+    node_pool_destroy(&pool);
+
+    /* End of part 4. */
+
+    /* Part 5. Deque with many elements, spanning many blocks */
+    const int total = 10 * DEQUE_BLOCK_LENGTH + 3;
+    numbers = deque_new();
+    assert(NULL != numbers);
+
+    /* It should push the elements at both ends, growing the map of blocks as needed */
+    for (int i = 0; i < total / 2; i++) {
+        rc = deque_push_back(numbers, number_new(total / 2 + i));
+        assert(DEQUE_RC_OK == rc);
+        rc = deque_push_front(numbers, number_new(total / 2 - 1 - i));
+        assert(DEQUE_RC_OK == rc);
+    }
+
+    rc = deque_push_back(numbers, number_new(total - 1));
+    assert(DEQUE_RC_OK == rc && (size_t)total == deque_count(numbers));
+
+    /* It should pick every element at its position */
+    for (int i = 0; i < total; i++) {
+        tmp = deque_pick_at(numbers, (size_t)i);
+        assert(NULL != tmp && i == *(int *)tmp);
+    }
+
+    /* It should return null when trying to pick an element out of the bounds of the deque */
+    assert(NULL == deque_pick_at(numbers, (size_t)total));
+    assert(NULL == deque_pick_at(NULL, 0));
+
+    /* It should keep the elements in order while moving them from the back to the front */
+    for (int i = 0; i < 3 * total; i++) {
+        tmp = deque_pop_back(numbers);
+        assert(NULL != tmp);
+        rc = deque_push_front(numbers, tmp);
+        assert(DEQUE_RC_OK == rc);
+    }
+
+    for (int i = 0; i < total; i++) {
+        tmp = deque_pick_at(numbers, (size_t)i);
+        assert(NULL != tmp && i == *(int *)tmp);
+    }
+
+    /* It should keep the elements in order while moving them from the front to the back */
+    for (int i = 0; i < 5 * total + 1; i++) {
+        tmp = deque_pop_front(numbers);
+        assert(NULL != tmp);
+        rc = deque_push_back(numbers, tmp);
+        assert(DEQUE_RC_OK == rc);
+    }
+
+    assert(1 == *(int *)deque_pick_front(numbers) && 0 == *(int *)deque_pick_back(numbers));
+
+    /* It should succeed at popping all the elements at both ends */
+    for (int i = 0; i < total / 2; i++) {
+        tmp = deque_pop_front(numbers);
+        assert(NULL != tmp && i + 1 == *(int *)tmp);
+        number_destroy(&tmp);
+    }
+
+    while (0 < deque_count(numbers)) {
+        tmp = deque_pop_back(numbers);
+        assert(NULL != tmp);
+        number_destroy(&tmp);
+    }
+
+    assert(NULL == deque_pick_front(numbers) && NULL == deque_pick_back(numbers));
+
+    rc = deque_destroy(&numbers, number_destroy);
+    assert(DEQUE_RC_EMPTY == rc && NULL == numbers);
+
+    /* End of part 5. */
+
     /* End of all tests. */
 
     return 0;
@@ -6,6 +6,39 @@
 #include "libdatastructures/list/doubly-linked-list.h"
 #include "number/number.h"
 
+/**
+ * \brief  Assert the list stores exactly the given numbers, in the same order, and that its nodes
+ *         are linked consistently in both directions.
+ * \param  list      the list whose elements are to be checked
+ * \param  expected  the expected numbers
+ * \param  n         the expected number of elements
+ */
+static void assert_numbers(d_l_list_s *list, const int *expected, size_t n)
+{
+    assert(n == list->count && (0 == n) == (NULL == list->front));
+
+    d_l_list_node_s *node = list->front;
+
+    for (size_t i = 0; i < n; i++) {
+        assert(expected[i] == *(int *)node->elem && node->next->prev == node);
+        node = node->next;
+    }
+
+    assert(node == list->front);
+
+    return;
+}
+
+/**
+ * \brief   Tell whether a number element is odd.
+ * \param   num  the number element
+ * \return  true if the number is odd, false otherwise
+ */
+static bool number_is_odd(void *num)
+{
+    return 0 != *(int *)num % 2;
+}
+
 int main(void)
 {
     d_l_list_rc_e rc;
@@ -241,6 +274,439 @@ int main(void)
     rc = d_l_list_destroy(&numbers, number_destroy);
     assert(D_L_LIST_RC_EMPTY == rc);
 
+    /* Part 5. List with a node pool */
+
+    numbers = d_l_list_new();
+    node_pool_s *pool = node_pool_new(sizeof(d_l_list_node_s), 4);
+    assert(NULL != numbers && NULL != pool && NULL == numbers->pool);
+
+    /* It should fail when setting the pool of a null list, or a pool of too small nodes */
+    rc = d_l_list_set_pool(NULL, pool);
+    assert(D_L_LIST_RC_NULL == rc);
+
+    node_pool_s *tiny_pool = node_pool_new(sizeof(void *), 4);
+    rc = d_l_list_set_pool(numbers, tiny_pool);
+    assert(D_L_LIST_RC_INVALID_POOL == rc && NULL == numbers->pool);
+    node_pool_destroy(&tiny_pool);
+
+    rc = d_l_list_set_pool(numbers, pool);
+    assert(D_L_LIST_RC_OK == rc && pool == numbers->pool);
+
+    /* It should allocate the nodes out of the pool, and reuse them once they're removed */
+    for (int i = 0; i < 6; i++) {
+        rc = d_l_list_insert_front(numbers, number_new(i));
+        assert(D_L_LIST_RC_OK == rc && (size_t)i + 1 == node_pool_count(pool));
+    }
+
+    /* It should fail when trying to change the pool of a non-empty list */
+    rc = d_l_list_set_pool(numbers, NULL);
+    assert(D_L_LIST_RC_NOT_EMPTY == rc && pool == numbers->pool);
+
+    tmp = d_l_list_remove_back(numbers);
+    assert(NULL != tmp && 0 == *(int *)tmp && 5 == node_pool_count(pool));
+    number_destroy(&tmp);
+
+    size_t capacity = pool->capacity;
+
+    for (int i = 0; i < 100; i++) {
+        rc = d_l_list_insert_back(numbers, number_new(i));
+        assert(D_L_LIST_RC_OK == rc);
+        tmp = d_l_list_remove_front(numbers);
+        assert(NULL != tmp);
+        number_destroy(&tmp);
+    }
+
+    assert(capacity == pool->capacity && 5 == node_pool_count(pool));
+
+    /* It should give all the nodes back to the pool when clearing the list */
+    rc = d_l_list_clear(numbers, number_destroy);
+    assert(D_L_LIST_RC_OK == rc && 0 == node_pool_count(pool));
+
+    rc = d_l_list_destroy(&numbers, number_destroy);
+    assert(D_L_LIST_RC_EMPTY == rc);
+    node_pool_destroy(&pool);
+    assert(NULL == pool);
+
+    /* End of part 5. */
+
+    /* Part 6. Concatenation, splice and split of lists */
+    numbers = d_l_list_new();
+    d_l_list_s *others = d_l_list_new();
+    assert(NULL != numbers && NULL != others);
+
+    /* It should fail when given null lists */
+    rc = d_l_list_concat(NULL, others);
+    assert(D_L_LIST_RC_NULL == rc);
+    rc = d_l_list_splice(numbers, NULL, NULL, NULL, NULL);
+    assert(D_L_LIST_RC_NULL == rc);
+    rc = d_l_list_split_at(numbers, 0, NULL);
+    assert(D_L_LIST_RC_NULL == rc);
+
+    /* It should do nothing when concatenating or splitting empty lists, and fail when splicing */
+    rc = d_l_list_concat(numbers, others);
+    assert(D_L_LIST_RC_OK == rc);
+    rc = d_l_list_split_at(numbers, 0, others);
+    assert(D_L_LIST_RC_OK == rc);
+    rc = d_l_list_split_at(numbers, 1, others);
+    assert(D_L_LIST_RC_OUT_OF_RANGE == rc);
+    rc = d_l_list_splice(others, NULL, numbers, numbers->front, numbers->front);
+    assert(D_L_LIST_RC_EMPTY == rc);
+    assert_numbers(numbers, NULL, 0);
+    assert_numbers(others, NULL, 0);
+
+    /* It should append all the nodes of a list to another one, keeping them in order */
+    for (int i = 0; i < 10; i++) {
+        rc = d_l_list_insert_back(i < 4 ? numbers : others, number_new(i));
+        assert(D_L_LIST_RC_OK == rc);
+    }
+
+    rc = d_l_list_concat(numbers, others);
+    assert(D_L_LIST_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }, 10);
+    assert_numbers(others, NULL, 0);
+
+    rc = d_l_list_concat(numbers, numbers);
+    assert(D_L_LIST_RC_OK == rc && 10 == numbers->count);
+
+    /* It should split the list, reaching the position from both ends */
+    rc = d_l_list_split_at(numbers, 11, others);
+    assert(D_L_LIST_RC_OUT_OF_RANGE == rc);
+
+    rc = d_l_list_split_at(numbers, 7, others);
+    assert(D_L_LIST_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 0, 1, 2, 3, 4, 5, 6 }, 7);
+    assert_numbers(others, (const int[]){ 7, 8, 9 }, 3);
+
+    rc = d_l_list_split_at(numbers, 2, others);
+    assert(D_L_LIST_RC_NOT_EMPTY == rc && 7 == numbers->count);
+
+    rc = d_l_list_concat(others, numbers);
+    assert(D_L_LIST_RC_OK == rc);
+    rc = d_l_list_split_at(others, 3, numbers);
+    assert(D_L_LIST_RC_OK == rc);
+    assert_numbers(others, (const int[]){ 7, 8, 9 }, 3);
+    assert_numbers(numbers, (const int[]){ 0, 1, 2, 3, 4, 5, 6 }, 7);
+
+    rc = d_l_list_concat(numbers, others);
+    assert(D_L_LIST_RC_OK == rc);
+    rc = d_l_list_split_at(numbers, 10, others);
+    assert(D_L_LIST_RC_OK == rc && 10 == numbers->count && 0 == others->count);
+
+    rc = d_l_list_split_at(numbers, 0, others);
+    assert(D_L_LIST_RC_OK == rc && 0 == numbers->count && 10 == others->count);
+    rc = d_l_list_concat(numbers, others);
+    assert(D_L_LIST_RC_OK == rc);
+
+    /* It should move a range of nodes onto another list, then back before a given node */
+    rc = d_l_list_splice(others, NULL, numbers, numbers->front->next,
+                         numbers->front->next->next->next);
+    assert(D_L_LIST_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 0, 4, 5, 6, 7, 8, 9 }, 7);
+    assert_numbers(others, (const int[]){ 1, 2, 3 }, 3);
+
+    rc = d_l_list_splice(numbers, numbers->front->next, others, others->front,
+                         others->front->prev);
+    assert(D_L_LIST_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }, 10);
+    assert_numbers(others, NULL, 0);
+
+    /* It should move a range of nodes within the same list, updating its front */
+    rc = d_l_list_splice(numbers, NULL, numbers, numbers->front, numbers->front->next);
+    assert(D_L_LIST_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 2, 3, 4, 5, 6, 7, 8, 9, 0, 1 }, 10);
+
+    rc = d_l_list_splice(numbers, numbers->front, numbers, numbers->front->prev->prev,
+                         numbers->front->prev);
+    assert(D_L_LIST_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }, 10);
+
+    /* It should fail when the range wraps around the list, or contains the destination node */
+    rc = d_l_list_splice(others, NULL, numbers, numbers->front->prev, numbers->front);
+    assert(D_L_LIST_RC_OUT_OF_RANGE == rc);
+    rc = d_l_list_splice(numbers, numbers->front->next, numbers, numbers->front,
+                         numbers->front->next->next);
+    assert(D_L_LIST_RC_OUT_OF_RANGE == rc);
+    rc = d_l_list_splice(numbers, numbers->front->next, numbers, numbers->front,
+                         numbers->front->next);
+    assert(D_L_LIST_RC_OUT_OF_RANGE == rc);
+    rc = d_l_list_splice(others, NULL, numbers, NULL, numbers->front);
+    assert(D_L_LIST_RC_OUT_OF_RANGE == rc);
+    assert_numbers(numbers, (const int[]){ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }, 10);
+
+    /* It should fail when the lists allocate their nodes out of different pools */
+    pool = node_pool_new(sizeof(d_l_list_node_s), 4);
+    rc = d_l_list_set_pool(others, pool);
+    assert(D_L_LIST_RC_OK == rc);
+    rc = d_l_list_concat(others, numbers);
+    assert(D_L_LIST_RC_POOL_MISMATCH == rc);
+    rc = d_l_list_splice(others, NULL, numbers, numbers->front, numbers->front);
+    assert(D_L_LIST_RC_POOL_MISMATCH == rc);
+    rc = d_l_list_split_at(numbers, 5, others);
+    assert(D_L_LIST_RC_POOL_MISMATCH == rc);
+    assert_numbers(numbers, (const int[]){ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }, 10);
+
+    rc = d_l_list_destroy(&numbers, number_destroy);
+    assert(D_L_LIST_RC_OK == rc);
+    rc = d_l_list_destroy(&others, number_destroy);
+    assert(D_L_LIST_RC_EMPTY == rc);
+    node_pool_destroy(&pool);
+
+    /* End of part 6. */
+
+    /* Part 7. Cursors */
+    numbers = d_l_list_new();
+    d_l_list_cursor_s cursor;
+    assert(NULL != numbers);
+
+    /* It should fail when given a null cursor or list */
+    rc = d_l_list_cursor_begin(NULL, numbers);
+    assert(D_L_LIST_RC_NULL == rc);
+    rc = d_l_list_cursor_end(&cursor, NULL);
+    assert(D_L_LIST_RC_NULL == rc);
+    rc = d_l_list_cursor_next(NULL);
+    assert(D_L_LIST_RC_NULL == rc);
+    rc = d_l_list_cursor_prev(NULL);
+    assert(D_L_LIST_RC_NULL == rc);
+    assert(NULL == d_l_list_cursor_get(NULL) && NULL == d_l_list_cursor_remove_current(NULL));
+
+    /* A cursor over an empty list should be at its end, and insert elements at its back */
+    rc = d_l_list_cursor_begin(&cursor, numbers);
+    assert(D_L_LIST_RC_EMPTY == rc && NULL == d_l_list_cursor_get(&cursor));
+    rc = d_l_list_cursor_next(&cursor);
+    assert(D_L_LIST_RC_OUT_OF_RANGE == rc);
+    rc = d_l_list_cursor_prev(&cursor);
+    assert(D_L_LIST_RC_EMPTY == rc);
+    assert(NULL == d_l_list_cursor_remove_current(&cursor));
+
+    tmp = number_new(0);
+    rc = d_l_list_cursor_insert_after(&cursor, tmp);
+    assert(D_L_LIST_RC_OUT_OF_RANGE == rc);
+    rc = d_l_list_cursor_insert_before(&cursor, tmp);
+    assert(D_L_LIST_RC_OK == rc && NULL == d_l_list_cursor_get(&cursor));
+
+    for (int i = 1; i < 8; i++) {
+        rc = d_l_list_cursor_insert_before(&cursor, number_new(i));
+        assert(D_L_LIST_RC_OK == rc);
+    }
+
+    assert_numbers(numbers, (const int[]){ 0, 1, 2, 3, 4, 5, 6, 7 }, 8);
+
+    /* It should iterate over the list in both directions, and stop at both ends */
+    rc = d_l_list_cursor_end(&cursor, numbers);
+    assert(D_L_LIST_RC_OK == rc);
+
+    for (int i = 7; i >= 0; i--) {
+        rc = d_l_list_cursor_prev(&cursor);
+        assert(D_L_LIST_RC_OK == rc && i == *(int *)d_l_list_cursor_get(&cursor));
+    }
+
+    rc = d_l_list_cursor_prev(&cursor);
+    assert(D_L_LIST_RC_OUT_OF_RANGE == rc && 0 == *(int *)d_l_list_cursor_get(&cursor));
+
+    for (int i = 0; i < 8; i++) {
+        assert(i == *(int *)d_l_list_cursor_get(&cursor));
+        rc = d_l_list_cursor_next(&cursor);
+        assert(D_L_LIST_RC_OK == rc);
+    }
+
+    assert(NULL == d_l_list_cursor_get(&cursor));
+
+    /* It should insert elements around the current one, including at both ends of the list */
+    rc = d_l_list_cursor_begin(&cursor, numbers);
+    assert(D_L_LIST_RC_OK == rc);
+    rc = d_l_list_cursor_insert_before(&cursor, number_new(-1));
+    assert(D_L_LIST_RC_OK == rc && 0 == *(int *)d_l_list_cursor_get(&cursor));
+    rc = d_l_list_cursor_insert_after(&cursor, number_new(10));
+    assert(D_L_LIST_RC_OK == rc);
+
+    rc = d_l_list_cursor_end(&cursor, numbers);
+    assert(D_L_LIST_RC_OK == rc);
+    rc = d_l_list_cursor_prev(&cursor);
+    assert(D_L_LIST_RC_OK == rc && 7 == *(int *)d_l_list_cursor_get(&cursor));
+    rc = d_l_list_cursor_insert_after(&cursor, number_new(9));
+    assert(D_L_LIST_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ -1, 0, 10, 1, 2, 3, 4, 5, 6, 7, 9 }, 11);
+
+    /* It should remove all the odd elements in a single pass, including the front and back ones */
+    rc = d_l_list_cursor_begin(&cursor, numbers);
+    assert(D_L_LIST_RC_OK == rc);
+
+    while (NULL != d_l_list_cursor_get(&cursor)) {
+        if (0 != *(int *)d_l_list_cursor_get(&cursor) % 2) {
+            tmp = d_l_list_cursor_remove_current(&cursor);
+            number_destroy(&tmp);
+        } else {
+            rc = d_l_list_cursor_next(&cursor);
+            assert(D_L_LIST_RC_OK == rc);
+        }
+    }
+
+    assert_numbers(numbers, (const int[]){ 0, 10, 2, 4, 6 }, 5);
+
+    /* It should remove every element, backwards, leaving the list empty */
+    while (D_L_LIST_RC_OK == d_l_list_cursor_prev(&cursor)) {
+        tmp = d_l_list_cursor_remove_current(&cursor);
+        assert(NULL != tmp && NULL == d_l_list_cursor_get(&cursor));
+        number_destroy(&tmp);
+    }
+
+    assert_numbers(numbers, NULL, 0);
+
+    rc = d_l_list_destroy(&numbers, number_destroy);
+    assert(D_L_LIST_RC_EMPTY == rc);
+
+    /* End of part 7. */
+
+    /* Part 8. Sorting */
+    const int nsorted = 200;
+    void *elems[200];
+    numbers = d_l_list_new();
+    assert(NULL != numbers);
+
+    /* It should fail when sorting a null or empty list, or without a callback function */
+    rc = d_l_list_sort(NULL, number_compare);
+    assert(D_L_LIST_RC_NULL == rc);
+    rc = d_l_list_sort(numbers, number_compare);
+    assert(D_L_LIST_RC_EMPTY == rc);
+
+    for (int i = 0; i < nsorted; i++) {
+        elems[i] = number_new(i * 7919 % nsorted % 13);
+        rc = d_l_list_insert_back(numbers, elems[i]);
+        assert(D_L_LIST_RC_OK == rc);
+    }
+
+    rc = d_l_list_sort(numbers, NULL);
+    assert(D_L_LIST_RC_ELEM_CB_NULL == rc);
+
+    /* It should sort the elements, keeping the 'equal' ones in their original order */
+    rc = d_l_list_sort(numbers, number_compare);
+    assert(D_L_LIST_RC_OK == rc && (size_t)nsorted == numbers->count);
+
+    d_l_list_node_s *node = numbers->front;
+
+    for (int k = 0; k < 13; k++) {
+        for (int i = 0; i < nsorted; i++) {
+            if (k == *(int *)elems[i]) {
+                assert(elems[i] == node->elem);
+                node = node->next;
+            }
+        }
+    }
+
+    assert(node == numbers->front);
+
+    /* It should merge two sorted lists, taking the elements of the first one first */
+    others = d_l_list_new();
+    assert(NULL != others);
+
+    rc = d_l_list_split_at(numbers, (size_t)nsorted / 2, others);
+    assert(D_L_LIST_RC_OK == rc);
+    rc = d_l_list_merge(numbers, others, NULL);
+    assert(D_L_LIST_RC_ELEM_CB_NULL == rc);
+    rc = d_l_list_merge(NULL, others, number_compare);
+    assert(D_L_LIST_RC_NULL == rc);
+
+    rc = d_l_list_merge(others, numbers, number_compare);
+    assert(D_L_LIST_RC_OK == rc && (size_t)nsorted == others->count && 0 == numbers->count);
+
+    for (node = others->front; node->next != others->front; node = node->next)
+        assert(0 <= number_compare(node->elem, node->next->elem) && node->next->prev == node);
+
+    d_l_list_node_s *first = others->front;
+    assert(0 == *(int *)first->elem && 0 == *(int *)first->next->elem);
+
+    /* It should merge a list onto an empty one, and do nothing when merging an empty one */
+    rc = d_l_list_merge(numbers, others, number_compare);
+    assert(D_L_LIST_RC_OK == rc && first == numbers->front && 0 == others->count);
+    rc = d_l_list_merge(numbers, others, number_compare);
+    assert(D_L_LIST_RC_OK == rc && (size_t)nsorted == numbers->count);
+
+    rc = d_l_list_destroy(&others, number_destroy);
+    assert(D_L_LIST_RC_EMPTY == rc);
+
+    rc = d_l_list_destroy(&numbers, number_destroy);
+    assert(D_L_LIST_RC_OK == rc);
+
+    /* End of part 8. */
+
+    /* Part 9. Search and removal of the elements matching a predicate */
+    numbers = d_l_list_new();
+    assert(NULL != numbers);
+
+    /* It should fail when given a null or empty list */
+    assert(NULL == d_l_list_find(NULL, NULL, number_compare));
+    rc = d_l_list_remove_if(NULL, number_is_odd, number_destroy);
+    assert(D_L_LIST_RC_NULL == rc);
+    rc = d_l_list_remove_if(numbers, number_is_odd, number_destroy);
+    assert(D_L_LIST_RC_EMPTY == rc);
+
+    for (int i = 0; i < 11; i++) {
+        rc = d_l_list_insert_back(numbers, number_new(i));
+        assert(D_L_LIST_RC_OK == rc);
+    }
+
+    /* It should find the first 'equal' element, or none */
+    void *key = number_new(7);
+    tmp = d_l_list_find(numbers, key, number_compare);
+    assert(NULL != tmp && tmp != key && 7 == *(int *)tmp);
+    assert(NULL == d_l_list_find(numbers, key, NULL));
+    number_destroy(&key);
+
+    key = number_new(11);
+    assert(NULL == d_l_list_find(numbers, key, number_compare));
+    number_destroy(&key);
+
+    rc = d_l_list_remove_if(numbers, NULL, number_destroy);
+    assert(D_L_LIST_RC_ELEM_CB_NULL == rc && 11 == numbers->count);
+
+    /* It should remove the odd elements, keeping the list circular */
+    rc = d_l_list_remove_if(numbers, number_is_odd, number_destroy);
+    assert(D_L_LIST_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 0, 2, 4, 6, 8, 10 }, 6);
+
+    /* It should remove the elements at both ends of the list */
+    tmp = d_l_list_remove_front(numbers);
+    number_destroy(&tmp);
+
+    for (int i = 3; i < 12; i += 2) {
+        rc = d_l_list_insert_back(numbers, number_new(i));
+        assert(D_L_LIST_RC_OK == rc);
+    }
+
+    rc = d_l_list_insert_front(numbers, number_new(1));
+    assert(D_L_LIST_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 1, 2, 4, 6, 8, 10, 3, 5, 7, 9, 11 }, 11);
+
+    rc = d_l_list_remove_if(numbers, number_is_odd, number_destroy);
+    assert(D_L_LIST_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 2, 4, 6, 8, 10 }, 5);
+    assert(10 == *(int *)numbers->front->prev->elem);
+
+    /* It should remove every element, leaving the list empty */
+    for (int i = 1; i < 6; i += 2) {
+        rc = d_l_list_insert_front(numbers, number_new(i));
+        assert(D_L_LIST_RC_OK == rc);
+    }
+
+    rc = d_l_list_remove_if(numbers, number_is_odd, number_destroy);
+    assert(D_L_LIST_RC_OK == rc && 5 == numbers->count);
+
+    for (int i = 0; i < 5; i++) {
+        tmp = d_l_list_remove_front(numbers);
+        rc = d_l_list_insert_back(numbers, number_new(*(int *)tmp + 1));
+        assert(D_L_LIST_RC_OK == rc);
+        number_destroy(&tmp);
+    }
+
+    rc = d_l_list_remove_if(numbers, number_is_odd, number_destroy);
+    assert(D_L_LIST_RC_OK == rc);
+    assert_numbers(numbers, NULL, 0);
+
+    rc = d_l_list_destroy(&numbers, number_destroy);
+    assert(D_L_LIST_RC_EMPTY == rc);
+
+    /* End of part 9. */
+
     /* End of all tests. */
 
     return 0;
@@ -0,0 +1,238 @@
+/**
+ * \file   intrusive-doubly-linked-list-test.c
+ * \brief  Circ. intrusive doubly linked list - unit test simulation for basic functions
+ */
+#include <assert.h>
+#include <stdlib.h>
+#include "libdatastructures/list/intrusive-doubly-linked-list.h"
+
+/** A connection, which is either in the idle list or in the active one */
+struct connection {
+    /** The connection id */
+    int id;
+    /** The link to the list the connection is in */
+    d_l_list_link_s link;
+};
+
+/** The next connection id expected by 'connection_check_next' */
+static int next_id;
+
+/** The step between the connection ids expected by 'connection_check_next' */
+static int id_step;
+
+/** No. of connections deallocated by 'connection_destroy' */
+static int destroyed;
+
+/**
+ * \brief  Check a connection is the expected one, then expect the next one.
+ * \param  link  the link of the connection
+ */
+static void connection_check_next(d_l_list_link_s *link)
+{
+    assert(next_id == D_L_LIST_CONTAINER_OF(link, struct connection, link)->id);
+    next_id += id_step;
+
+    return;
+}
+
+/**
+ * \brief  Deallocate a connection.
+ * \param  link  the link of the connection
+ */
+static void connection_destroy(d_l_list_link_s *link)
+{
+    assert(!d_l_list_link_is_linked(link));
+    free(D_L_LIST_CONTAINER_OF(link, struct connection, link));
+    destroyed++;
+
+    return;
+}
+
+int main(void)
+{
+    i_d_l_list_rc_e rc;
+    d_l_list_link_s *tmp = NULL;
+    struct connection dummy = {.id = 0};
+
+    d_l_list_link_init(&dummy.link);
+    assert(!d_l_list_link_is_linked(&dummy.link));
+
+    /* Part 1. Null list */
+    i_d_l_list_s *idle = NULL;
+
+    /* It should do nothing when trying to initialize a null list */
+    i_d_l_list_init(idle);
+    assert(NULL == idle);
+
+    /* It should fail when trying to insert elements into a null list */
+    rc = i_d_l_list_insert_front(idle, &dummy.link);
+    assert(I_D_L_LIST_RC_NULL == rc);
+    rc = i_d_l_list_insert_back(idle, &dummy.link);
+    assert(I_D_L_LIST_RC_NULL == rc && !d_l_list_link_is_linked(&dummy.link));
+    assert(0 == i_d_l_list_count(idle));
+    assert(NULL == i_d_l_list_front(idle) && NULL == i_d_l_list_back(idle));
+
+    /* It should fail when trying to traverse a null list */
+    rc = i_d_l_list_traverse_forward(idle, connection_check_next);
+    assert(I_D_L_LIST_RC_NULL == rc);
+    rc = i_d_l_list_traverse_backward(idle, connection_check_next);
+    assert(I_D_L_LIST_RC_NULL == rc);
+
+    /* It should fail when trying to remove an element from a null list */
+    rc = i_d_l_list_remove(idle, &dummy.link);
+    assert(I_D_L_LIST_RC_NULL == rc);
+    tmp = i_d_l_list_remove_front(idle);
+    assert(NULL == tmp);
+    tmp = i_d_l_list_remove_back(idle);
+    assert(NULL == tmp);
+
+    /* It should fail when trying to empty or destroy a null list */
+    rc = i_d_l_list_clear(idle, connection_destroy);
+    assert(I_D_L_LIST_RC_NULL == rc);
+    rc = i_d_l_list_destroy(NULL, connection_destroy);
+    assert(I_D_L_LIST_RC_NULL == rc);
+    rc = i_d_l_list_destroy(&idle, connection_destroy);
+    assert(I_D_L_LIST_RC_NULL == rc);
+
+    /* End of part 1. */
+
+    /* Part 2. Empty list */
+    idle = i_d_l_list_new();
+    assert(NULL != idle && NULL == idle->front && 0 == i_d_l_list_count(idle));
+
+    /* It should fail when trying to insert a null link, traverse it or remove an element */
+    rc = i_d_l_list_insert_back(idle, NULL);
+    assert(I_D_L_LIST_RC_ELEM_NULL == rc && 0 == i_d_l_list_count(idle));
+    rc = i_d_l_list_traverse_forward(idle, connection_check_next);
+    assert(I_D_L_LIST_RC_EMPTY == rc);
+    rc = i_d_l_list_traverse_backward(idle, connection_check_next);
+    assert(I_D_L_LIST_RC_EMPTY == rc);
+    rc = i_d_l_list_remove(idle, NULL);
+    assert(I_D_L_LIST_RC_ELEM_NULL == rc);
+    rc = i_d_l_list_remove(idle, &dummy.link);
+    assert(I_D_L_LIST_RC_ELEM_NOT_LINKED == rc);
+    assert(NULL == i_d_l_list_remove_front(idle));
+    assert(NULL == i_d_l_list_remove_back(idle));
+
+    /* End of part 2. */
+
+    /* Part 3. List with a single element */
+
+    /* The element should point to itself when it's inserted onto the empty list */
+    rc = i_d_l_list_insert_back(idle, &dummy.link);
+    assert(I_D_L_LIST_RC_OK == rc && &dummy.link == idle->front && 1 == i_d_l_list_count(idle));
+    assert(dummy.link.next == &dummy.link && dummy.link.prev == &dummy.link);
+    assert(&dummy.link == i_d_l_list_front(idle) && &dummy.link == i_d_l_list_back(idle));
+
+    /* It should fail when trying to insert an element which is already in a list */
+    rc = i_d_l_list_insert_front(idle, &dummy.link);
+    assert(I_D_L_LIST_RC_ELEM_LINKED == rc && 1 == i_d_l_list_count(idle));
+
+    /* The list should be empty again after removing the single element from the list */
+    tmp = i_d_l_list_remove_front(idle);
+    assert(&dummy.link == tmp && NULL == idle->front && 0 == i_d_l_list_count(idle));
+    assert(!d_l_list_link_is_linked(&dummy.link));
+
+    rc = i_d_l_list_insert_front(idle, &dummy.link);
+    assert(I_D_L_LIST_RC_OK == rc && 1 == i_d_l_list_count(idle));
+    rc = i_d_l_list_remove(idle, &dummy.link);
+    assert(I_D_L_LIST_RC_OK == rc && NULL == idle->front && 0 == i_d_l_list_count(idle));
+
+    /* End of part 3. */
+
+    /* Part 4. Moving elements between lists */
+    const int total = 16;
+    struct connection *conns[16];
+    i_d_l_list_s active;
+
+    i_d_l_list_init(&active);
+
+    for (int i = 0; i < total; i++) {
+        conns[i] = (struct connection *)malloc(sizeof(*conns[i]));
+        assert(NULL != conns[i]);
+        conns[i]->id = i;
+        d_l_list_link_init(&conns[i]->link);
+    }
+
+    /* It should insert the elements at both ends, in order */
+    for (int i = total / 2; i < total; i++) {
+        rc = i_d_l_list_insert_back(idle, &conns[i]->link);
+        assert(I_D_L_LIST_RC_OK == rc);
+    }
+
+    for (int i = total / 2 - 1; i >= 0; i--) {
+        rc = i_d_l_list_insert_front(idle, &conns[i]->link);
+        assert(I_D_L_LIST_RC_OK == rc);
+    }
+
+    assert((size_t)total == i_d_l_list_count(idle));
+
+    next_id = 0;
+    id_step = 1;
+    rc = i_d_l_list_traverse_forward(idle, connection_check_next);
+    assert(I_D_L_LIST_RC_OK == rc && total == next_id);
+
+    next_id = total - 1;
+    id_step = -1;
+    rc = i_d_l_list_traverse_backward(idle, connection_check_next);
+    assert(I_D_L_LIST_RC_OK == rc && -1 == next_id);
+
+    rc = i_d_l_list_traverse_forward(idle, NULL);
+    assert(I_D_L_LIST_RC_ELEM_CB_NULL == rc);
+
+    /* It should move the odd elements to the other list, given only their links */
+    for (int i = 1; i < total; i += 2) {
+        rc = i_d_l_list_remove(idle, &conns[i]->link);
+        assert(I_D_L_LIST_RC_OK == rc && !d_l_list_link_is_linked(&conns[i]->link));
+        rc = i_d_l_list_insert_back(&active, &conns[i]->link);
+        assert(I_D_L_LIST_RC_OK == rc);
+    }
+
+    assert((size_t)total / 2 == i_d_l_list_count(idle));
+    assert((size_t)total / 2 == i_d_l_list_count(&active));
+
+    next_id = 0;
+    id_step = 2;
+    rc = i_d_l_list_traverse_forward(idle, connection_check_next);
+    assert(I_D_L_LIST_RC_OK == rc && total == next_id);
+
+    next_id = 1;
+    rc = i_d_l_list_traverse_forward(&active, connection_check_next);
+    assert(I_D_L_LIST_RC_OK == rc && total + 1 == next_id);
+
+    /* It should remove the elements at both ends, and the front one given only its link */
+    tmp = i_d_l_list_remove_front(idle);
+    assert(&conns[0]->link == tmp && &conns[2]->link == i_d_l_list_front(idle));
+    rc = i_d_l_list_insert_back(&active, tmp);
+    assert(I_D_L_LIST_RC_OK == rc);
+
+    tmp = i_d_l_list_remove_back(idle);
+    assert(&conns[total - 2]->link == tmp && &conns[total - 4]->link == i_d_l_list_back(idle));
+    rc = i_d_l_list_insert_front(&active, tmp);
+    assert(I_D_L_LIST_RC_OK == rc);
+
+    rc = i_d_l_list_remove(idle, &conns[2]->link);
+    assert(I_D_L_LIST_RC_OK == rc && &conns[4]->link == i_d_l_list_front(idle));
+    rc = i_d_l_list_insert_back(&active, &conns[2]->link);
+    assert(I_D_L_LIST_RC_OK == rc);
+
+    assert((size_t)total / 2 - 3 == i_d_l_list_count(idle));
+    assert((size_t)total / 2 + 3 == i_d_l_list_count(&active));
+    assert(&conns[total - 2]->link == i_d_l_list_front(&active));
+    assert(&conns[2]->link == i_d_l_list_back(&active));
+
+    /* It should succeed at removing all elements from the lists, handing them to the callback */
+    destroyed = 0;
+    rc = i_d_l_list_clear(&active, connection_destroy);
+    assert(I_D_L_LIST_RC_OK == rc && NULL == active.front && 0 == i_d_l_list_count(&active));
+    assert(total / 2 + 3 == destroyed);
+
+    rc = i_d_l_list_destroy(&idle, connection_destroy);
+    assert(I_D_L_LIST_RC_OK == rc && NULL == idle && total == destroyed);
+
+    /* End of part 4. */
+
+    /* End of all tests. */
+
+    return 0;
+}
@@ -0,0 +1,220 @@
+/**
+ * \file   mpmc-queue-test.c
+ * \brief  Lock-free bounded MPMC queue - unit test simulation for basic functions
+ */
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include "libdatastructures/queue/mpmc-queue.h"
+#include "number/number.h"
+
+/** No. of producer threads (and of consumer ones) */
+#define NTHREADS 8
+
+/** No. of elements enqueued by every producer thread */
+#define NELEMS 2000
+
+/** The queue shared by the producer and consumer threads */
+static mpmc_queue_s *shared;
+
+/** The elements enqueued by the producers: the j-th one of the i-th producer is 'i * NELEMS + j' */
+static int elems[NTHREADS * NELEMS];
+
+/** No. of times every element has been dequeued */
+static atomic_int dequeued[NTHREADS * NELEMS];
+
+/** Total no. of elements dequeued by the consumers */
+static atomic_int total_dequeued;
+
+/**
+ * \brief   Enqueue the elements of a producer, in order, retrying while the queue is full.
+ * \param   arg  pointer to the first element of the producer
+ * \return  null
+ */
+static void *producer_run(void *arg)
+{
+    int *first = (int *)arg;
+
+    for (int i = 0; i < NELEMS; i++) {
+        while (MPMC_QUEUE_RC_FULL == mpmc_queue_enqueue(shared, &first[i]))
+            sched_yield();
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief   Dequeue elements until all the elements of the producers have been dequeued, checking
+ *          the elements of every producer are dequeued in order.
+ * \param   arg  unused
+ * \return  null
+ */
+static void *consumer_run(void *arg)
+{
+    int last[NTHREADS];
+
+    (void)arg;
+
+    for (int i = 0; i < NTHREADS; i++)
+        last[i] = -1;
+
+    while (NTHREADS * NELEMS > atomic_load(&total_dequeued)) {
+        int *elem = (int *)mpmc_queue_try_dequeue(shared);
+
+        if (NULL == elem) {
+            sched_yield();
+            continue;
+        }
+
+        assert(last[*elem / NELEMS] < *elem);
+        last[*elem / NELEMS] = *elem;
+        atomic_fetch_add(&dequeued[*elem], 1);
+        atomic_fetch_add(&total_dequeued, 1);
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    mpmc_queue_rc_e rc;
+    void *tmp = NULL;
+
+    /* Part 1. Null queue */
+    mpmc_queue_s *numbers = NULL;
+
+    /* It should do nothing when trying to initialize a null queue */
+    mpmc_queue_init(numbers, 4);
+    assert(NULL == numbers);
+
+    /* It should fail when trying to enqueue an element into a null queue */
+    void *dummy = number_new(0);
+    rc = mpmc_queue_enqueue(numbers, dummy);
+    assert(MPMC_QUEUE_RC_NULL == rc);
+
+    /* It should return null when trying to dequeue an element off a null queue */
+    tmp = mpmc_queue_try_dequeue(numbers);
+    assert(NULL == tmp);
+
+    /* It should return zero when getting the number of elements or capacity of a null queue */
+    assert(0 == mpmc_queue_count(numbers) && 0 == mpmc_queue_capacity(numbers));
+
+    /* It should fail when trying to empty or destroy a null queue */
+    rc = mpmc_queue_clear(numbers, number_destroy);
+    assert(MPMC_QUEUE_RC_NULL == rc);
+    rc = mpmc_queue_destroy(NULL, number_destroy);
+    assert(MPMC_QUEUE_RC_NULL == rc);
+    rc = mpmc_queue_destroy(&numbers, number_destroy);
+    assert(MPMC_QUEUE_RC_NULL == rc);
+
+    /* End of part 1. */
+
+    /* Part 2. Empty queue */
+
+    /* Its capacity should be rounded up to a power of two, and to at least 2 */
+    numbers = mpmc_queue_new(0);
+    assert(NULL != numbers && 2 == mpmc_queue_capacity(numbers));
+    rc = mpmc_queue_destroy(&numbers, number_destroy);
+    assert(MPMC_QUEUE_RC_EMPTY == rc && NULL == numbers);
+
+    /* Its capacity should be zero (so it's always full) when it's too large to be allocated */
+    numbers = mpmc_queue_new(SIZE_MAX);
+    assert(NULL != numbers && 0 == mpmc_queue_capacity(numbers));
+    rc = mpmc_queue_enqueue(numbers, dummy);
+    assert(MPMC_QUEUE_RC_FULL == rc && 0 == mpmc_queue_count(numbers));
+    rc = mpmc_queue_destroy(&numbers, number_destroy);
+    assert(MPMC_QUEUE_RC_EMPTY == rc && NULL == numbers);
+
+    numbers = mpmc_queue_new(5);
+    assert(NULL != numbers && 8 == mpmc_queue_capacity(numbers));
+    assert(0 == mpmc_queue_count(numbers));
+
+    /* It should fail when trying to enqueue a null element */
+    rc = mpmc_queue_enqueue(numbers, NULL);
+    assert(MPMC_QUEUE_RC_ELEM_NULL == rc && 0 == mpmc_queue_count(numbers));
+
+    /* It should return null when trying to dequeue an element off an empty queue */
+    tmp = mpmc_queue_try_dequeue(numbers);
+    assert(NULL == tmp);
+
+    /* It should return 'empty queue' when trying to empty an empty queue */
+    rc = mpmc_queue_clear(numbers, number_destroy);
+    assert(MPMC_QUEUE_RC_EMPTY == rc);
+
+    /* End of part 2. */
+
+    /* Part 3. Non-empty queue */
+
+    /* It should succeed when enqueueing elements until the queue gets full */
+    for (int i = 0; i < 8; i++) {
+        rc = mpmc_queue_enqueue(numbers, number_new(i));
+        assert(MPMC_QUEUE_RC_OK == rc && (size_t)i + 1 == mpmc_queue_count(numbers));
+    }
+
+    /* It should fail when trying to enqueue an element into a full queue */
+    rc = mpmc_queue_enqueue(numbers, dummy);
+    assert(MPMC_QUEUE_RC_FULL == rc && 8 == mpmc_queue_count(numbers));
+
+    /* It should keep the elements in order across many laps of the ring buffer */
+    for (int i = 0; i < 100; i++) {
+        tmp = mpmc_queue_try_dequeue(numbers);
+        assert(NULL != tmp && i == *(int *)tmp && 7 == mpmc_queue_count(numbers));
+        number_destroy(&tmp);
+
+        rc = mpmc_queue_enqueue(numbers, number_new(i + 8));
+        assert(MPMC_QUEUE_RC_OK == rc && 8 == mpmc_queue_count(numbers));
+    }
+
+    /* It should succeed at removing all elements from the queue, handing them to the callback */
+    rc = mpmc_queue_clear(numbers, number_destroy);
+    assert(MPMC_QUEUE_RC_OK == rc && 0 == mpmc_queue_count(numbers));
+
+    rc = mpmc_queue_enqueue(numbers, dummy);
+    assert(MPMC_QUEUE_RC_OK == rc);
+    rc = mpmc_queue_destroy(&numbers, number_destroy);
+    assert(MPMC_QUEUE_RC_OK == rc && NULL == numbers);
+
+    /* End of part 3. */
+
+    /* Part 4. Queue shared by many producer and consumer threads */
+    pthread_t producers[NTHREADS];
+    pthread_t consumers[NTHREADS];
+
+    shared = mpmc_queue_new(64);
+    assert(NULL != shared);
+
+    for (int i = 0; i < NTHREADS * NELEMS; i++) {
+        elems[i] = i;
+        atomic_init(&dequeued[i], 0);
+    }
+
+    atomic_init(&total_dequeued, 0);
+
+    /* Every element should be dequeued exactly once, and in order for every producer */
+    for (int i = 0; i < NTHREADS; i++) {
+        int err = pthread_create(&consumers[i], NULL, consumer_run, NULL);
+        assert(0 == err);
+        err = pthread_create(&producers[i], NULL, producer_run, &elems[i * NELEMS]);
+        assert(0 == err);
+    }
+
+    for (int i = 0; i < NTHREADS; i++) {
+        pthread_join(producers[i], NULL);
+        pthread_join(consumers[i], NULL);
+    }
+
+    for (int i = 0; i < NTHREADS * NELEMS; i++)
+        assert(1 == atomic_load(&dequeued[i]));
+
+    assert(0 == mpmc_queue_count(shared));
+    rc = mpmc_queue_destroy(&shared, NULL);
+    assert(MPMC_QUEUE_RC_EMPTY == rc && NULL == shared);
+
+    /* End of part 4. */
+
+    /* End of all tests. */
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+/**
+ * \file   node-pool-test.c
+ * \brief  Node pool (slab allocator) - unit test simulation for basic functions
+ */
+#include <assert.h>
+#include <stdint.h>
+#include "libdatastructures/pool/node-pool.h"
+
+/** A node made of three pointers, as a doubly linked list node */
+struct triple {
+    void *a;
+    void *b;
+    void *c;
+};
+
+int main(void)
+{
+    node_pool_rc_e rc;
+
+    /* Part 1. Null node pool */
+    node_pool_s *pool = NULL;
+
+    /* It should do nothing when trying to initialize a null pool */
+    node_pool_init(pool, sizeof(struct triple), 4);
+    assert(NULL == pool);
+
+    /* It should fail when trying to use a null pool */
+    rc = node_pool_reserve(pool, 10);
+    assert(NODE_POOL_RC_NULL == rc);
+    assert(NULL == node_pool_alloc(pool));
+    assert(0 == node_pool_count(pool));
+    node_pool_free(pool, NULL);
+
+    /* It should fail when trying to destroy a null pool */
+    rc = node_pool_destroy(NULL);
+    assert(NODE_POOL_RC_NULL == rc);
+    rc = node_pool_destroy(&pool);
+    assert(NODE_POOL_RC_NULL == rc);
+
+    /* End of part 1. */
+
+    /* Part 2. Allocating and freeing nodes */
+
+    pool = node_pool_new(sizeof(struct triple), 4);
+    assert(NULL != pool && 0 == node_pool_count(pool) && NULL == pool->slabs);
+    assert(sizeof(struct triple) <= pool->node_size && 0 == pool->node_size % sizeof(void *));
+
+    /* It should allocate aligned, distinct and writable nodes, a slab at a time */
+    struct triple *nodes[10];
+
+    for (int i = 0; i < 10; i++) {
+        nodes[i] = (struct triple *)node_pool_alloc(pool);
+        assert(NULL != nodes[i] && 0 == (uintptr_t)nodes[i] % sizeof(void *));
+        nodes[i]->a = nodes[i]->b = nodes[i]->c = &nodes[i];
+
+        for (int j = 0; j < i; j++)
+            assert(nodes[i] != nodes[j]);
+    }
+
+    assert(10 == node_pool_count(pool) && 12 == pool->capacity);
+
+    for (int i = 0; i < 10; i++)
+        assert(nodes[i]->a == &nodes[i] && nodes[i]->c == &nodes[i]);
+
+    /* It should reuse the freed nodes, most recently freed first, without allocating any slab */
+    node_pool_free(pool, nodes[3]);
+    node_pool_free(pool, nodes[7]);
+    node_pool_free(pool, NULL);
+    assert(8 == node_pool_count(pool));
+
+    assert(nodes[7] == node_pool_alloc(pool));
+    assert(nodes[3] == node_pool_alloc(pool));
+    assert(10 == node_pool_count(pool) && 12 == pool->capacity);
+
+    /* It should allocate only as many slabs as needed when reserving nodes */
+    rc = node_pool_reserve(pool, 2);
+    assert(NODE_POOL_RC_OK == rc && 12 == pool->capacity);
+    rc = node_pool_reserve(pool, 7);
+    assert(NODE_POOL_RC_OK == rc && 20 == pool->capacity && 10 == node_pool_count(pool));
+
+    for (int i = 0; i < 10; i++)
+        node_pool_free(pool, nodes[i]);
+
+    assert(0 == node_pool_count(pool) && 20 == pool->capacity);
+
+    /* It should succeed when destroying the pool, including all its slabs */
+    rc = node_pool_destroy(&pool);
+    assert(NODE_POOL_RC_OK == rc && NULL == pool);
+
+    /* End of part 2. */
+
+    /* Part 3. Tiny nodes and default slab length */
+
+    /* It should make room for the free list link on nodes smaller than a pointer */
+    pool = node_pool_new(1, 0);
+    assert(NULL != pool && sizeof(void *) == pool->node_size);
+    assert(NODE_POOL_DEFAULT_SLAB_LENGTH == pool->slab_length);
+
+    void *tiny = node_pool_alloc(pool);
+    assert(NULL != tiny && 1 == node_pool_count(pool));
+    node_pool_free(pool, tiny);
+
+    rc = node_pool_destroy(&pool);
+    assert(NODE_POOL_RC_OK == rc && NULL == pool);
+
+    /* End of part 3. */
+
+    /* End of all tests. */
+
+    return 0;
+}
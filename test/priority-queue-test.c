@@ -0,0 +1,277 @@
+/**
+ * \file   priority-queue-test.c
+ * \brief  Priority queue (d-ary heap) data structure - unit test simulation for basic functions
+ */
+#include <assert.h>
+#include <stdlib.h>
+#include "libdatastructures/queue/priority-queue.h"
+#include "number/number.h"
+#include "rand-perm/rand-perm.h"
+
+/** A task, whose priority may be raised while it's in the priority queue */
+struct task {
+    /** The task priority (the lesser, the sooner) */
+    int prio;
+    /** The index of the task in the priority queue */
+    size_t idx;
+};
+
+/**
+ * \brief   Compare two tasks by their priorities.
+ * \param   t1  the first task
+ * \param   t2  the second task
+ * \return  > 0 if the second task priority is greater than the first one's, < 0 if it's lesser, 0
+ *          otherwise
+ */
+static int task_compare(void *t1, void *t2)
+{
+    return ((struct task *)t2)->prio - ((struct task *)t1)->prio;
+}
+
+/**
+ * \brief  Store the index of a task in the priority queue.
+ * \param  t    the task
+ * \param  idx  the index of the task
+ */
+static void task_index(void *t, size_t idx)
+{
+    ((struct task *)t)->idx = idx;
+
+    return;
+}
+
+/**
+ * \brief  Check a priority queue of numbers pops them all in ascending order, emptying it.
+ * \param  numbers  the priority queue
+ * \param  n        the number of numbers, which are expected to be 0 to n - 1
+ */
+static void assert_pops_in_order(pq_s *numbers, int n)
+{
+    void *tmp;
+
+    assert((size_t)n == pq_count(numbers));
+
+    for (int i = 0; i < n; i++) {
+        assert(i == *(int *)pq_peek(numbers));
+        tmp = pq_pop_min(numbers);
+        assert(NULL != tmp && i == *(int *)tmp && (size_t)(n - i - 1) == pq_count(numbers));
+        number_destroy(&tmp);
+    }
+
+    assert(NULL == pq_peek(numbers) && NULL == pq_pop_min(numbers));
+
+    return;
+}
+
+int main(void)
+{
+    pq_rc_e rc;
+    void *tmp = NULL;
+
+    /* Part 1. Null priority queue */
+    pq_s *numbers = NULL;
+
+    /* It should do nothing when trying to initialize a null priority queue */
+    pq_init(numbers, 2, number_compare);
+    assert(NULL == numbers);
+
+    /* It should fail when trying to push elements onto a null priority queue */
+    void *dummy = number_new(0);
+    rc = pq_push(numbers, dummy);
+    assert(PQ_RC_NULL == rc);
+    rc = pq_heapify(numbers, &dummy, 1);
+    assert(PQ_RC_NULL == rc);
+    rc = pq_set_elem_index(numbers, task_index);
+    assert(PQ_RC_NULL == rc);
+
+    /* It should return null when trying to peek or pop an element off a null priority queue */
+    assert(NULL == pq_peek(numbers) && NULL == pq_pop_min(numbers) && 0 == pq_count(numbers));
+
+    /* It should fail when trying to decrease a key, empty or destroy a null priority queue */
+    rc = pq_decrease_key(numbers, 0);
+    assert(PQ_RC_NULL == rc);
+    rc = pq_clear(numbers, number_destroy);
+    assert(PQ_RC_NULL == rc);
+    rc = pq_destroy(NULL, number_destroy);
+    assert(PQ_RC_NULL == rc);
+    rc = pq_destroy(&numbers, number_destroy);
+    assert(PQ_RC_NULL == rc);
+
+    /* End of part 1. */
+
+    /* Part 2. Empty priority queue */
+
+    /* It should fail when trying to push an element without a comparison function */
+    numbers = pq_new(2, NULL);
+    assert(NULL != numbers && 0 == pq_count(numbers));
+    rc = pq_push(numbers, dummy);
+    assert(PQ_RC_ELEM_CB_NULL == rc && 0 == pq_count(numbers));
+    rc = pq_heapify(numbers, &dummy, 1);
+    assert(PQ_RC_ELEM_CB_NULL == rc && 0 == pq_count(numbers));
+    rc = pq_destroy(&numbers, number_destroy);
+    assert(PQ_RC_EMPTY == rc && NULL == numbers);
+
+    numbers = pq_new(2, number_compare);
+    assert(NULL != numbers && 0 == pq_count(numbers));
+
+    /* It should fail when trying to push a null element */
+    rc = pq_push(numbers, NULL);
+    assert(PQ_RC_ELEM_NULL == rc && 0 == pq_count(numbers));
+
+    /* It should return null when trying to peek or pop an element off an empty priority queue */
+    assert(NULL == pq_peek(numbers) && NULL == pq_pop_min(numbers));
+
+    /* It should fail when trying to decrease a key or empty an empty priority queue */
+    rc = pq_decrease_key(numbers, 0);
+    assert(PQ_RC_EMPTY == rc);
+    rc = pq_clear(numbers, number_destroy);
+    assert(PQ_RC_EMPTY == rc);
+
+    /* End of part 2. */
+
+    /* Part 3. Binary and 4-ary heaps */
+    const int total = 1000;
+    rand_perm_gen_t gen;
+
+    for (size_t arity = 2; arity <= 4; arity += 2) {
+        if (4 == arity) {
+            rc = pq_destroy(&numbers, number_destroy);
+            assert(PQ_RC_EMPTY == rc);
+            numbers = pq_new(arity, number_compare);
+            assert(NULL != numbers);
+        }
+
+        /* It should pop the pushed elements in ascending order, in spite of the pushing order */
+        rand_perm_gen_init(&gen, 0, total - 1);
+
+        for (int i = 0; i < total; i++) {
+            rc = pq_push(numbers, number_new(rand_perm_gen_get_next(&gen)));
+            assert(PQ_RC_OK == rc && (size_t)i + 1 == pq_count(numbers));
+        }
+
+        rand_perm_gen_destroy(&gen);
+        assert_pops_in_order(numbers, total);
+
+        /* It should do the same when pushing duplicated elements, and popping while pushing */
+        for (int i = total - 1; i >= 0; i--) {
+            rc = pq_push(numbers, number_new(i / 2));
+            assert(PQ_RC_OK == rc);
+        }
+
+        for (int i = 0; i < total; i++) {
+            tmp = pq_pop_min(numbers);
+            assert(NULL != tmp && i / 2 == *(int *)tmp);
+            number_destroy(&tmp);
+
+            if (i < total / 2) {
+                rc = pq_push(numbers, number_new(total / 2 + i));
+                assert(PQ_RC_OK == rc);
+            }
+        }
+
+        assert(total / 2 == (int)pq_count(numbers));
+        rc = pq_clear(numbers, number_destroy);
+        assert(PQ_RC_OK == rc && 0 == pq_count(numbers));
+    }
+
+    /* End of part 3. */
+
+    /* Part 4. Heapifying an array of elements */
+    void *elems[1000];
+
+    /* It should fail when trying to heapify a null array, or one holding a null element */
+    rc = pq_heapify(numbers, NULL, 0);
+    assert(PQ_RC_OK == rc && 0 == pq_count(numbers));
+    rc = pq_heapify(numbers, NULL, 1);
+    assert(PQ_RC_ELEM_NULL == rc && 0 == pq_count(numbers));
+
+    rand_perm_gen_init(&gen, 0, total - 1);
+
+    for (int i = 0; i < total; i++)
+        elems[i] = number_new(rand_perm_gen_get_next(&gen));
+
+    rand_perm_gen_destroy(&gen);
+
+    tmp = elems[total / 2];
+    elems[total / 2] = NULL;
+    rc = pq_heapify(numbers, elems, (size_t)total);
+    assert(PQ_RC_ELEM_NULL == rc && 0 == pq_count(numbers));
+    elems[total / 2] = tmp;
+
+    /* It should heapify the elements, along with the ones already in the priority queue */
+    for (int i = 0; i < total / 4; i++) {
+        rc = pq_push(numbers, elems[i]);
+        assert(PQ_RC_OK == rc);
+    }
+
+    rc = pq_heapify(numbers, &elems[total / 4], (size_t)(total - total / 4));
+    assert(PQ_RC_OK == rc);
+    assert_pops_in_order(numbers, total);
+
+    rc = pq_destroy(&numbers, number_destroy);
+    assert(PQ_RC_EMPTY == rc && NULL == numbers);
+
+    /* End of part 4. */
+
+    /* Part 5. Decreasing the keys of the elements in place */
+    struct task tasks[64];
+    pq_s *tasks_pq = pq_new(4, task_compare);
+    assert(NULL != tasks_pq);
+
+    for (int i = 0; i < 32; i++) {
+        tasks[i].prio = 100 + i;
+        rc = pq_push(tasks_pq, &tasks[i]);
+        assert(PQ_RC_OK == rc);
+    }
+
+    /* It should tell every element its index, including the ones already in the queue */
+    rc = pq_set_elem_index(tasks_pq, task_index);
+    assert(PQ_RC_OK == rc);
+
+    for (int i = 32; i < 64; i++) {
+        tasks[i].prio = 100 + i;
+        elems[i - 32] = &tasks[i];
+    }
+
+    rc = pq_heapify(tasks_pq, elems, 32);
+    assert(PQ_RC_OK == rc && 64 == pq_count(tasks_pq));
+
+    for (int i = 0; i < 64; i++)
+        assert(&tasks[i] == tasks_pq->array.elems[tasks[i].idx]);
+
+    /* It should fail when trying to decrease the key of an element out of the heap */
+    rc = pq_decrease_key(tasks_pq, 64);
+    assert(PQ_RC_OUT_OF_RANGE == rc);
+
+    /* It should move the elements whose keys are decreased towards the root */
+    for (int i = 1; i < 64; i += 2) {
+        tasks[i].prio = -i;
+        rc = pq_decrease_key(tasks_pq, tasks[i].idx);
+        assert(PQ_RC_OK == rc && &tasks[i] == pq_peek(tasks_pq));
+    }
+
+    for (int i = 0; i < 64; i++)
+        assert(&tasks[i] == tasks_pq->array.elems[tasks[i].idx]);
+
+    /* The odd tasks should be popped first, from the highest one, then the even ones */
+    for (int i = 63; i >= 1; i -= 2) {
+        tmp = pq_pop_min(tasks_pq);
+        assert(&tasks[i] == tmp);
+    }
+
+    for (int i = 0; i < 64; i += 2) {
+        tmp = pq_pop_min(tasks_pq);
+        assert(&tasks[i] == tmp);
+    }
+
+    rc = pq_destroy(&tasks_pq, NULL);
+    assert(PQ_RC_EMPTY == rc && NULL == tasks_pq);
+
+    /* End of part 5. */
+
+    number_destroy(&dummy);
+
+    /* End of all tests. */
+
+    return 0;
+}
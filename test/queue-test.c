@@ -6,6 +6,16 @@
 #include "libdatastructures/queue/queue.h"
 #include "number/number.h"
 
+/**
+ * \brief   Tell whether a number element is odd.
+ * \param   num  the number element
+ * \return  true if the number is odd, false otherwise
+ */
+static bool number_is_odd(void *num)
+{
+    return 0 != *(int *)num % 2;
+}
+
 int main(void)
 {
     queue_rc_e rc;
@@ -136,5 +146,115 @@ int main(void)
     rc = queue_destroy(&numbers, number_destroy);
     assert(QUEUE_RC_EMPTY == rc && NULL == numbers && 0 == queue_count(numbers));
 
+    /* Part 4. Queue with a node pool shared with another queue */
+
+    numbers = queue_new();
+    queue_s *others = queue_new();
+    node_pool_s *pool = node_pool_new(sizeof(s_l_list_node_s), 8);
+    assert(NULL != numbers && NULL != others && NULL != pool);
+
+    /* It should fail when setting the pool of a null queue */
+    rc = queue_set_pool(NULL, pool);
+    assert(QUEUE_RC_NULL == rc);
+
+    rc = queue_set_pool(numbers, pool);
+    assert(QUEUE_RC_OK == rc);
+    rc = queue_set_pool(others, pool);
+    assert(QUEUE_RC_OK == rc);
+
+    /* It should allocate the nodes of both queues out of the shared pool */
+    for (int i = 0; i < 4; i++) {
+        rc = queue_enqueue(numbers, number_new(i));
+        assert(QUEUE_RC_OK == rc);
+        rc = queue_enqueue(others, number_new(i));
+        assert(QUEUE_RC_OK == rc);
+    }
+
+    assert(8 == node_pool_count(pool));
+
+    /* It should fail when trying to change the pool of a non-empty queue */
+    rc = queue_set_pool(numbers, NULL);
+    assert(QUEUE_RC_NOT_EMPTY == rc);
+
+    tmp = queue_dequeue(numbers);
+    assert(NULL != tmp && 7 == node_pool_count(pool));
+    number_destroy(&tmp);
+
+    rc = queue_destroy(&numbers, number_destroy);
+    assert(QUEUE_RC_OK == rc && 4 == node_pool_count(pool));
+    rc = queue_destroy(&others, number_destroy);
+    assert(QUEUE_RC_OK == rc && 0 == node_pool_count(pool));
+    node_pool_destroy(&pool);
+
+    /* End of part 4. */
+
+    /* Part 5. Removal of the elements matching a predicate */
+    numbers = queue_new();
+    assert(NULL != numbers);
+
+    rc = queue_remove_if(NULL, number_is_odd, number_destroy);
+    assert(QUEUE_RC_NULL == rc);
+    rc = queue_remove_if(numbers, number_is_odd, number_destroy);
+    assert(QUEUE_RC_EMPTY == rc);
+
+    for (int i = 0; i < 9; i++) {
+        rc = queue_enqueue(numbers, number_new(i));
+        assert(QUEUE_RC_OK == rc);
+    }
+
+    rc = queue_remove_if(numbers, NULL, number_destroy);
+    assert(QUEUE_RC_ELEM_CB_NULL == rc && 9 == queue_count(numbers));
+
+    /* It should drop the odd elements, and keep the others in order */
+    rc = queue_remove_if(numbers, number_is_odd, number_destroy);
+    assert(QUEUE_RC_OK == rc && 5 == queue_count(numbers));
+
+    for (int i = 0; i < 10; i += 2) {
+        tmp = queue_dequeue(numbers);
+        assert(NULL != tmp && i == *(int *)tmp);
+        number_destroy(&tmp);
+    }
+
+    rc = queue_destroy(&numbers, number_destroy);
+    assert(QUEUE_RC_EMPTY == rc);
+
+    /* End of part 5. */
+
+    /* Part 6. Dequeueing many elements at once */
+    void *batch[4];
+
+    numbers = queue_new();
+    assert(NULL != numbers);
+
+    /* It should dequeue no elements off a null or empty queue */
+    assert(0 == queue_dequeue_batch(NULL, batch, 4));
+    assert(0 == queue_dequeue_batch(numbers, batch, 4));
+
+    for (int i = 0; i < 6; i++) {
+        rc = queue_enqueue(numbers, number_new(i));
+        assert(QUEUE_RC_OK == rc);
+    }
+
+    /* It should dequeue up to the maximum number of elements, and then the remaining ones */
+    assert(0 == queue_dequeue_batch(numbers, NULL, 4) && 6 == queue_count(numbers));
+    assert(4 == queue_dequeue_batch(numbers, batch, 4) && 2 == queue_count(numbers));
+
+    for (int i = 0; i < 4; i++) {
+        assert(i == *(int *)batch[i]);
+        number_destroy(&batch[i]);
+    }
+
+    assert(2 == queue_dequeue_batch(numbers, batch, 4) && 0 == queue_count(numbers));
+
+    for (int i = 0; i < 2; i++) {
+        assert(4 + i == *(int *)batch[i]);
+        number_destroy(&batch[i]);
+    }
+
+    rc = queue_destroy(&numbers, number_destroy);
+    assert(QUEUE_RC_EMPTY == rc);
+
+    /* End of part 6. */
+
     return 0;
 }
@@ -6,6 +6,34 @@
 #include "libdatastructures/list/singly-linked-list.h"
 #include "number/number.h"
 
+/**
+ * \brief  Assert the list stores exactly the given numbers, in the same order.
+ * \param  list      the list whose elements are to be checked
+ * \param  expected  the expected numbers
+ * \param  n         the expected number of elements
+ */
+static void assert_numbers(s_l_list_s *list, const int *expected, size_t n)
+{
+    assert(n == list->count && (0 == n) == (NULL == list->back));
+
+    for (size_t i = 0; i < n; i++) {
+        list->back = list->back->next;
+        assert(expected[i] == *(int *)list->back->elem);
+    }
+
+    return;
+}
+
+/**
+ * \brief   Tell whether a number element is odd.
+ * \param   num  the number element
+ * \return  true if the number is odd, false otherwise
+ */
+static bool number_is_odd(void *num)
+{
+    return 0 != *(int *)num % 2;
+}
+
 int main(void)
 {
     s_l_list_rc_e rc;
@@ -192,6 +220,356 @@ int main(void)
     rc = s_l_list_destroy(&numbers, number_destroy);
     assert(S_L_LIST_RC_EMPTY == rc);
 
+    /* Part 5. List with a node pool */
+
+    numbers = s_l_list_new();
+    node_pool_s *pool = node_pool_new(sizeof(s_l_list_node_s), 4);
+    assert(NULL != numbers && NULL != pool && NULL == numbers->pool);
+
+    /* It should fail when setting the pool of a null list, or a pool of too small nodes */
+    rc = s_l_list_set_pool(NULL, pool);
+    assert(S_L_LIST_RC_NULL == rc);
+
+    node_pool_s *tiny_pool = node_pool_new(1, 4);
+    rc = s_l_list_set_pool(numbers, tiny_pool);
+    assert(S_L_LIST_RC_INVALID_POOL == rc && NULL == numbers->pool);
+    node_pool_destroy(&tiny_pool);
+
+    rc = s_l_list_set_pool(numbers, pool);
+    assert(S_L_LIST_RC_OK == rc && pool == numbers->pool);
+
+    /* It should allocate the nodes out of the pool, and reuse them once they're removed */
+    for (int i = 0; i < 6; i++) {
+        rc = s_l_list_insert_back(numbers, number_new(i));
+        assert(S_L_LIST_RC_OK == rc && (size_t)i + 1 == node_pool_count(pool));
+    }
+
+    /* It should fail when trying to change the pool of a non-empty list */
+    rc = s_l_list_set_pool(numbers, NULL);
+    assert(S_L_LIST_RC_NOT_EMPTY == rc && pool == numbers->pool);
+
+    tmp = s_l_list_remove_front(numbers);
+    assert(NULL != tmp && 0 == *(int *)tmp && 5 == node_pool_count(pool));
+    number_destroy(&tmp);
+
+    size_t capacity = pool->capacity;
+
+    for (int i = 0; i < 100; i++) {
+        rc = s_l_list_insert_back(numbers, number_new(i));
+        assert(S_L_LIST_RC_OK == rc);
+        tmp = s_l_list_remove_front(numbers);
+        assert(NULL != tmp);
+        number_destroy(&tmp);
+    }
+
+    assert(capacity == pool->capacity && 5 == node_pool_count(pool));
+
+    /* It should give all the nodes back to the pool when clearing the list */
+    rc = s_l_list_clear(numbers, number_destroy);
+    assert(S_L_LIST_RC_OK == rc && 0 == node_pool_count(pool));
+
+    rc = s_l_list_destroy(&numbers, number_destroy);
+    assert(S_L_LIST_RC_EMPTY == rc);
+    node_pool_destroy(&pool);
+    assert(NULL == pool);
+
+    /* End of part 5. */
+
+    /* Part 6. Concatenation of lists */
+    numbers = s_l_list_new();
+    s_l_list_s *others = s_l_list_new();
+    assert(NULL != numbers && NULL != others);
+
+    /* It should fail when concatenating null lists */
+    rc = s_l_list_concat(NULL, others);
+    assert(S_L_LIST_RC_NULL == rc);
+    rc = s_l_list_concat(numbers, NULL);
+    assert(S_L_LIST_RC_NULL == rc);
+
+    /* It should do nothing when concatenating an empty list */
+    rc = s_l_list_concat(numbers, others);
+    assert(S_L_LIST_RC_OK == rc && NULL == numbers->back && 0 == numbers->count);
+
+    /* It should move all the nodes onto an empty list */
+    for (int i = 0; i < 3; i++) {
+        rc = s_l_list_insert_back(others, number_new(i));
+        assert(S_L_LIST_RC_OK == rc);
+    }
+
+    s_l_list_node_s *back = others->back;
+
+    rc = s_l_list_concat(numbers, others);
+    assert(S_L_LIST_RC_OK == rc && back == numbers->back && 3 == numbers->count);
+    assert(NULL == others->back && 0 == others->count);
+
+    /* It should append all the nodes to a non-empty list, keeping them in order */
+    for (int i = 3; i < 7; i++) {
+        rc = s_l_list_insert_back(others, number_new(i));
+        assert(S_L_LIST_RC_OK == rc);
+    }
+
+    back = others->back;
+
+    rc = s_l_list_concat(numbers, others);
+    assert(S_L_LIST_RC_OK == rc && back == numbers->back && 7 == numbers->count);
+    assert(NULL == others->back && 0 == others->count);
+
+    /* It should do nothing when concatenating a list to itself */
+    rc = s_l_list_concat(numbers, numbers);
+    assert(S_L_LIST_RC_OK == rc && back == numbers->back && 7 == numbers->count);
+
+    /* It should fail when the lists allocate their nodes out of different pools */
+    pool = node_pool_new(sizeof(s_l_list_node_s), 4);
+    rc = s_l_list_set_pool(others, pool);
+    assert(S_L_LIST_RC_OK == rc);
+    rc = s_l_list_insert_back(others, number_new(7));
+    assert(S_L_LIST_RC_OK == rc);
+    rc = s_l_list_concat(numbers, others);
+    assert(S_L_LIST_RC_POOL_MISMATCH == rc && 7 == numbers->count);
+    assert(1 == others->count);
+
+    for (int i = 0; i < 7; i++) {
+        tmp = s_l_list_remove_front(numbers);
+        assert(NULL != tmp && i == *(int *)tmp);
+        number_destroy(&tmp);
+    }
+
+    rc = s_l_list_destroy(&numbers, number_destroy);
+    assert(S_L_LIST_RC_EMPTY == rc);
+    rc = s_l_list_destroy(&others, number_destroy);
+    assert(S_L_LIST_RC_OK == rc);
+    node_pool_destroy(&pool);
+
+    /* End of part 6. */
+
+    /* Part 7. Cursors */
+    numbers = s_l_list_new();
+    s_l_list_cursor_s cursor;
+    assert(NULL != numbers);
+
+    /* It should fail when given a null cursor or list */
+    rc = s_l_list_cursor_begin(NULL, numbers);
+    assert(S_L_LIST_RC_NULL == rc);
+    rc = s_l_list_cursor_begin(&cursor, NULL);
+    assert(S_L_LIST_RC_NULL == rc);
+    rc = s_l_list_cursor_next(NULL);
+    assert(S_L_LIST_RC_NULL == rc);
+    assert(NULL == s_l_list_cursor_get(NULL) && NULL == s_l_list_cursor_remove_current(NULL));
+
+    /* A cursor over an empty list should be at its end, and insert elements at its back */
+    rc = s_l_list_cursor_begin(&cursor, numbers);
+    assert(S_L_LIST_RC_EMPTY == rc && NULL == s_l_list_cursor_get(&cursor));
+    rc = s_l_list_cursor_next(&cursor);
+    assert(S_L_LIST_RC_OUT_OF_RANGE == rc);
+    assert(NULL == s_l_list_cursor_remove_current(&cursor));
+    tmp = number_new(0);
+    rc = s_l_list_cursor_insert_after(&cursor, tmp);
+    assert(S_L_LIST_RC_OUT_OF_RANGE == rc);
+    number_destroy(&tmp);
+    rc = s_l_list_cursor_insert_before(&cursor, NULL);
+    assert(S_L_LIST_RC_ELEM_NULL == rc);
+
+    for (int i = 0; i < 8; i++) {
+        rc = s_l_list_cursor_insert_before(&cursor, number_new(i));
+        assert(S_L_LIST_RC_OK == rc && NULL == s_l_list_cursor_get(&cursor));
+    }
+
+    assert_numbers(numbers, (const int[]){ 0, 1, 2, 3, 4, 5, 6, 7 }, 8);
+
+    /* It should stop at a given element, then insert elements around it */
+    rc = s_l_list_cursor_begin(&cursor, numbers);
+    assert(S_L_LIST_RC_OK == rc);
+
+    while (NULL != s_l_list_cursor_get(&cursor) && 3 != *(int *)s_l_list_cursor_get(&cursor))
+        s_l_list_cursor_next(&cursor);
+
+    rc = s_l_list_cursor_insert_before(&cursor, number_new(20));
+    assert(S_L_LIST_RC_OK == rc);
+    rc = s_l_list_cursor_insert_after(&cursor, number_new(30));
+    assert(S_L_LIST_RC_OK == rc && 3 == *(int *)s_l_list_cursor_get(&cursor));
+    assert_numbers(numbers, (const int[]){ 0, 1, 2, 20, 3, 30, 4, 5, 6, 7 }, 10);
+
+    /* It should insert at both ends of the list */
+    rc = s_l_list_cursor_begin(&cursor, numbers);
+    assert(S_L_LIST_RC_OK == rc);
+    rc = s_l_list_cursor_insert_before(&cursor, number_new(-1));
+    assert(S_L_LIST_RC_OK == rc && 0 == *(int *)s_l_list_cursor_get(&cursor));
+
+    rc = s_l_list_cursor_end(&cursor, numbers);
+    assert(S_L_LIST_RC_OK == rc);
+    rc = s_l_list_cursor_insert_before(&cursor, number_new(8));
+    assert(S_L_LIST_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ -1, 0, 1, 2, 20, 3, 30, 4, 5, 6, 7, 8 }, 12);
+
+    /* It should remove all the odd elements in a single pass, including the back one */
+    rc = s_l_list_cursor_begin(&cursor, numbers);
+    assert(S_L_LIST_RC_OK == rc);
+
+    while (NULL != s_l_list_cursor_get(&cursor)) {
+        if (0 != *(int *)s_l_list_cursor_get(&cursor) % 2) {
+            tmp = s_l_list_cursor_remove_current(&cursor);
+            number_destroy(&tmp);
+        } else {
+            rc = s_l_list_cursor_next(&cursor);
+            assert(S_L_LIST_RC_OK == rc);
+        }
+    }
+
+    assert_numbers(numbers, (const int[]){ 0, 2, 20, 30, 4, 6, 8 }, 7);
+
+    /* The cursor should be left at the end, so it inserts elements at the back */
+    tmp = number_new(9);
+    rc = s_l_list_cursor_insert_before(&cursor, tmp);
+    assert(S_L_LIST_RC_OK == rc && tmp == numbers->back->elem && 8 == numbers->count);
+
+    /* It should remove every element, leaving the list empty */
+    rc = s_l_list_cursor_begin(&cursor, numbers);
+    assert(S_L_LIST_RC_OK == rc);
+
+    while (NULL != (tmp = s_l_list_cursor_remove_current(&cursor)))
+        number_destroy(&tmp);
+
+    assert_numbers(numbers, NULL, 0);
+
+    rc = s_l_list_destroy(&numbers, number_destroy);
+    assert(S_L_LIST_RC_EMPTY == rc);
+
+    /* End of part 7. */
+
+    /* Part 8. Sorting */
+    const int nsorted = 200;
+    void *elems[200];
+    numbers = s_l_list_new();
+    assert(NULL != numbers);
+
+    /* It should fail when sorting a null or empty list, or without a callback function */
+    rc = s_l_list_sort(NULL, number_compare);
+    assert(S_L_LIST_RC_NULL == rc);
+    rc = s_l_list_sort(numbers, number_compare);
+    assert(S_L_LIST_RC_EMPTY == rc);
+
+    for (int i = 0; i < nsorted; i++) {
+        elems[i] = number_new(i * 7919 % nsorted % 13);
+        rc = s_l_list_insert_back(numbers, elems[i]);
+        assert(S_L_LIST_RC_OK == rc);
+    }
+
+    rc = s_l_list_sort(numbers, NULL);
+    assert(S_L_LIST_RC_ELEM_CB_NULL == rc);
+
+    /* It should sort the elements, keeping the 'equal' ones in their original order */
+    rc = s_l_list_sort(numbers, number_compare);
+    assert(S_L_LIST_RC_OK == rc && (size_t)nsorted == numbers->count);
+
+    s_l_list_node_s *node = numbers->back->next;
+
+    for (int k = 0; k < 13; k++) {
+        for (int i = 0; i < nsorted; i++) {
+            if (k == *(int *)elems[i]) {
+                assert(elems[i] == node->elem);
+                node = node->next;
+            }
+        }
+    }
+
+    assert(node == numbers->back->next);
+
+    /* It should keep an already sorted list as it is */
+    back = numbers->back;
+
+    rc = s_l_list_sort(numbers, number_compare);
+    assert(S_L_LIST_RC_OK == rc && back == numbers->back);
+
+    node = numbers->back->next;
+
+    for (int i = 0; i < nsorted; i++) {
+        assert(0 <= number_compare(node->elem, node->next->elem) || node == numbers->back);
+        node = node->next;
+    }
+
+    rc = s_l_list_destroy(&numbers, number_destroy);
+    assert(S_L_LIST_RC_OK == rc);
+
+    /* End of part 8. */
+
+    /* Part 9. Search and removal of the elements matching a predicate */
+    numbers = s_l_list_new();
+    assert(NULL != numbers);
+
+    /* It should fail when given a null or empty list */
+    assert(NULL == s_l_list_find(NULL, NULL, number_compare));
+    rc = s_l_list_remove_if(NULL, number_is_odd, number_destroy);
+    assert(S_L_LIST_RC_NULL == rc);
+    rc = s_l_list_remove_if(numbers, number_is_odd, number_destroy);
+    assert(S_L_LIST_RC_EMPTY == rc);
+
+    for (int i = 0; i < 11; i++) {
+        rc = s_l_list_insert_back(numbers, number_new(i));
+        assert(S_L_LIST_RC_OK == rc);
+    }
+
+    /* It should find the first 'equal' element, or none */
+    void *key = number_new(7);
+    tmp = s_l_list_find(numbers, key, number_compare);
+    assert(NULL != tmp && tmp != key && 7 == *(int *)tmp);
+    assert(NULL == s_l_list_find(numbers, key, NULL));
+    number_destroy(&key);
+
+    key = number_new(11);
+    assert(NULL == s_l_list_find(numbers, key, number_compare));
+    number_destroy(&key);
+
+    rc = s_l_list_remove_if(numbers, NULL, number_destroy);
+    assert(S_L_LIST_RC_ELEM_CB_NULL == rc && 11 == numbers->count);
+
+    /* It should remove the odd elements, keeping the list circular */
+    rc = s_l_list_remove_if(numbers, number_is_odd, number_destroy);
+    assert(S_L_LIST_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 0, 2, 4, 6, 8, 10 }, 6);
+
+    /* It should remove the elements at both ends of the list */
+    tmp = s_l_list_remove_front(numbers);
+    number_destroy(&tmp);
+
+    for (int i = 3; i < 12; i += 2) {
+        rc = s_l_list_insert_back(numbers, number_new(i));
+        assert(S_L_LIST_RC_OK == rc);
+    }
+
+    rc = s_l_list_insert_front(numbers, number_new(1));
+    assert(S_L_LIST_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 1, 2, 4, 6, 8, 10, 3, 5, 7, 9, 11 }, 11);
+
+    rc = s_l_list_remove_if(numbers, number_is_odd, number_destroy);
+    assert(S_L_LIST_RC_OK == rc);
+    assert_numbers(numbers, (const int[]){ 2, 4, 6, 8, 10 }, 5);
+    assert(10 == *(int *)numbers->back->elem);
+
+    /* It should remove every element, leaving the list empty */
+    for (int i = 1; i < 6; i += 2) {
+        rc = s_l_list_insert_front(numbers, number_new(i));
+        assert(S_L_LIST_RC_OK == rc);
+    }
+
+    rc = s_l_list_remove_if(numbers, number_is_odd, number_destroy);
+    assert(S_L_LIST_RC_OK == rc && 5 == numbers->count);
+
+    for (int i = 0; i < 5; i++) {
+        tmp = s_l_list_remove_front(numbers);
+        rc = s_l_list_insert_back(numbers, number_new(*(int *)tmp + 1));
+        assert(S_L_LIST_RC_OK == rc);
+        number_destroy(&tmp);
+    }
+
+    rc = s_l_list_remove_if(numbers, number_is_odd, number_destroy);
+    assert(S_L_LIST_RC_OK == rc);
+    assert_numbers(numbers, NULL, 0);
+
+    rc = s_l_list_destroy(&numbers, number_destroy);
+    assert(S_L_LIST_RC_EMPTY == rc);
+
+    /* End of part 9. */
+
     /* End of all tests. */
 
     return 0;
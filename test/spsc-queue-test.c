@@ -0,0 +1,248 @@
+/**
+ * \file   spsc-queue-test.c
+ * \brief  Wait-free bounded SPSC queue - unit test simulation for basic functions
+ */
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include "libdatastructures/queue/spsc-queue.h"
+#include "number/number.h"
+
+/** No. of elements passed from the producer thread to the consumer one */
+#define NELEMS 100000
+
+/** No. of elements enqueued (or dequeued) at once by the batch operations */
+#define BATCH 16
+
+/** The queue shared by the producer and the consumer threads */
+static spsc_queue_s *shared;
+
+/** The elements passed from the producer thread to the consumer one */
+static int elems[NELEMS];
+
+/**
+ * \brief   Enqueue all the elements, in batches, retrying while the queue is full.
+ * \param   arg  unused
+ * \return  null
+ */
+static void *producer_run(void *arg)
+{
+    void *batch[BATCH];
+    size_t i = 0;
+
+    (void)arg;
+
+    while (i < NELEMS) {
+        size_t n = 0;
+
+        while (n < BATCH && i + n < NELEMS) {
+            batch[n] = &elems[i + n];
+            n++;
+        }
+
+        size_t enqueued = spsc_queue_enqueue_batch(shared, batch, n);
+
+        if (0 == enqueued)
+            sched_yield();
+
+        i += enqueued;
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    spsc_queue_rc_e rc;
+    void *tmp = NULL;
+    void *batch[BATCH];
+
+    /* Part 1. Null queue */
+    spsc_queue_s *numbers = NULL;
+
+    /* It should do nothing when trying to initialize a null queue */
+    spsc_queue_init(numbers, 4);
+    assert(NULL == numbers);
+
+    /* It should fail when trying to enqueue elements into a null queue */
+    void *dummy = number_new(0);
+    rc = spsc_queue_enqueue(numbers, dummy);
+    assert(SPSC_QUEUE_RC_NULL == rc);
+    assert(0 == spsc_queue_enqueue_batch(numbers, &dummy, 1));
+
+    /* It should return null when trying to pick or dequeue elements off a null queue */
+    tmp = spsc_queue_pick(numbers);
+    assert(NULL == tmp);
+    tmp = spsc_queue_dequeue(numbers);
+    assert(NULL == tmp);
+    assert(0 == spsc_queue_dequeue_batch(numbers, batch, BATCH));
+
+    /* It should return zero when getting the number of elements or capacity of a null queue */
+    assert(0 == spsc_queue_count(numbers) && 0 == spsc_queue_capacity(numbers));
+
+    /* It should fail when trying to empty or destroy a null queue */
+    rc = spsc_queue_clear(numbers, number_destroy);
+    assert(SPSC_QUEUE_RC_NULL == rc);
+    rc = spsc_queue_destroy(NULL, number_destroy);
+    assert(SPSC_QUEUE_RC_NULL == rc);
+    rc = spsc_queue_destroy(&numbers, number_destroy);
+    assert(SPSC_QUEUE_RC_NULL == rc);
+
+    /* End of part 1. */
+
+    /* Part 2. Empty queue */
+
+    /* Its capacity should be rounded up to a power of two */
+    /* Its capacity should be zero (so it's always full) when it's too large to be allocated */
+    numbers = spsc_queue_new(SIZE_MAX);
+    assert(NULL != numbers && 0 == spsc_queue_capacity(numbers));
+    rc = spsc_queue_enqueue(numbers, dummy);
+    assert(SPSC_QUEUE_RC_FULL == rc && 0 == spsc_queue_count(numbers));
+    rc = spsc_queue_destroy(&numbers, number_destroy);
+    assert(SPSC_QUEUE_RC_EMPTY == rc && NULL == numbers);
+
+    numbers = spsc_queue_new(5);
+    assert(NULL != numbers && 8 == spsc_queue_capacity(numbers));
+    assert(0 == spsc_queue_count(numbers));
+
+    /* It should fail when trying to enqueue a null element */
+    rc = spsc_queue_enqueue(numbers, NULL);
+    assert(SPSC_QUEUE_RC_ELEM_NULL == rc && 0 == spsc_queue_count(numbers));
+
+    /* It should return null when trying to pick or dequeue elements off an empty queue */
+    tmp = spsc_queue_pick(numbers);
+    assert(NULL == tmp);
+    tmp = spsc_queue_dequeue(numbers);
+    assert(NULL == tmp);
+    assert(0 == spsc_queue_dequeue_batch(numbers, batch, BATCH));
+
+    /* It should return 'empty queue' when trying to empty an empty queue */
+    rc = spsc_queue_clear(numbers, number_destroy);
+    assert(SPSC_QUEUE_RC_EMPTY == rc);
+
+    /* End of part 2. */
+
+    /* Part 3. Non-empty queue */
+
+    /* It should succeed when enqueueing elements until the queue gets full */
+    for (int i = 0; i < 8; i++) {
+        rc = spsc_queue_enqueue(numbers, number_new(i));
+        assert(SPSC_QUEUE_RC_OK == rc && (size_t)i + 1 == spsc_queue_count(numbers));
+        assert(0 == *(int *)spsc_queue_pick(numbers));
+    }
+
+    /* It should fail when trying to enqueue elements into a full queue */
+    rc = spsc_queue_enqueue(numbers, dummy);
+    assert(SPSC_QUEUE_RC_FULL == rc && 8 == spsc_queue_count(numbers));
+    assert(0 == spsc_queue_enqueue_batch(numbers, &dummy, 1));
+
+    /* It should keep the elements in order across many laps of the ring buffer */
+    for (int i = 0; i < 100; i++) {
+        tmp = spsc_queue_dequeue(numbers);
+        assert(NULL != tmp && i == *(int *)tmp && 7 == spsc_queue_count(numbers));
+        number_destroy(&tmp);
+
+        rc = spsc_queue_enqueue(numbers, number_new(i + 8));
+        assert(SPSC_QUEUE_RC_OK == rc && 8 == spsc_queue_count(numbers));
+    }
+
+    /* It should dequeue a batch of elements, up to the number of elements in the queue */
+    size_t n = spsc_queue_dequeue_batch(numbers, batch, BATCH);
+    assert(8 == n && 0 == spsc_queue_count(numbers));
+
+    for (size_t i = 0; i < n; i++) {
+        assert(100 + (int)i == *(int *)batch[i]);
+        number_destroy(&batch[i]);
+    }
+
+    /* It should enqueue a batch of elements, up to the first null one or the queue capacity */
+    for (int i = 0; i < BATCH; i++)
+        batch[i] = number_new(i);
+
+    n = spsc_queue_enqueue_batch(numbers, batch, BATCH);
+    assert(8 == n && 8 == spsc_queue_count(numbers));
+
+    for (int i = 0; i < 4; i++) {
+        tmp = spsc_queue_dequeue(numbers);
+        assert(NULL != tmp && i == *(int *)tmp);
+        number_destroy(&tmp);
+    }
+
+    tmp = batch[10];
+    batch[10] = NULL;
+    n = spsc_queue_enqueue_batch(numbers, &batch[8], BATCH - 8);
+    assert(2 == n && 6 == spsc_queue_count(numbers));
+    batch[10] = tmp;
+
+    for (int i = 10; i < BATCH; i++)
+        number_destroy(&batch[i]);
+
+    n = spsc_queue_dequeue_batch(numbers, batch, 4);
+    assert(4 == n && 2 == spsc_queue_count(numbers));
+
+    for (size_t i = 0; i < n; i++) {
+        assert(4 + (int)i == *(int *)batch[i]);
+        number_destroy(&batch[i]);
+    }
+
+    assert(8 == *(int *)spsc_queue_pick(numbers));
+
+    /* It should succeed at removing all elements from the queue, handing them to the callback */
+    rc = spsc_queue_clear(numbers, number_destroy);
+    assert(SPSC_QUEUE_RC_OK == rc && 0 == spsc_queue_count(numbers));
+
+    rc = spsc_queue_enqueue(numbers, dummy);
+    assert(SPSC_QUEUE_RC_OK == rc);
+    rc = spsc_queue_destroy(&numbers, number_destroy);
+    assert(SPSC_QUEUE_RC_OK == rc && NULL == numbers);
+
+    /* End of part 3. */
+
+    /* Part 4. Queue shared by a producer thread and a consumer one */
+    pthread_t producer;
+    size_t next = 0;
+
+    shared = spsc_queue_new(64);
+    assert(NULL != shared);
+
+    for (int i = 0; i < NELEMS; i++)
+        elems[i] = i;
+
+    int err = pthread_create(&producer, NULL, producer_run, NULL);
+    assert(0 == err);
+
+    /* The consumer should dequeue all the elements in order, singly or in batches */
+    while (next < NELEMS) {
+        if (0 == next % 2) {
+            tmp = spsc_queue_dequeue(shared);
+
+            if (NULL != tmp) {
+                assert((int)next == *(int *)tmp);
+                next++;
+            }
+
+            continue;
+        }
+
+        n = spsc_queue_dequeue_batch(shared, batch, BATCH);
+
+        if (0 == n)
+            sched_yield();
+
+        for (size_t i = 0; i < n; i++, next++)
+            assert((int)next == *(int *)batch[i]);
+    }
+
+    pthread_join(producer, NULL);
+
+    assert(0 == spsc_queue_count(shared));
+    rc = spsc_queue_destroy(&shared, NULL);
+    assert(SPSC_QUEUE_RC_EMPTY == rc && NULL == shared);
+
+    /* End of part 4. */
+
+    /* End of all tests. */
+
+    return 0;
+}
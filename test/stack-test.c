@@ -136,5 +136,107 @@ int main(void)
     rc = stack_destroy(&numbers, number_destroy);
     assert(STACK_RC_EMPTY == rc && NULL == numbers && 0 == stack_count(numbers));
 
+    /* Part 4. Stack with a node pool shared with another stack */
+
+    numbers = stack_new();
+    stack_s *others = stack_new();
+    node_pool_s *pool = node_pool_new(sizeof(s_l_list_node_s), 8);
+    assert(NULL != numbers && NULL != others && NULL != pool);
+
+    /* It should fail when setting the pool of a null stack */
+    rc = stack_set_pool(NULL, pool);
+    assert(STACK_RC_NULL == rc);
+
+    rc = stack_set_pool(numbers, pool);
+    assert(STACK_RC_OK == rc);
+    rc = stack_set_pool(others, pool);
+    assert(STACK_RC_OK == rc);
+
+    /* It should allocate the nodes of both stacks out of the shared pool */
+    for (int i = 0; i < 4; i++) {
+        rc = stack_push(numbers, number_new(i));
+        assert(STACK_RC_OK == rc);
+        rc = stack_push(others, number_new(i));
+        assert(STACK_RC_OK == rc);
+    }
+
+    assert(8 == node_pool_count(pool));
+
+    /* It should fail when trying to change the pool of a non-empty stack */
+    rc = stack_set_pool(numbers, NULL);
+    assert(STACK_RC_NOT_EMPTY == rc);
+
+    tmp = stack_pop(numbers);
+    assert(NULL != tmp && 7 == node_pool_count(pool));
+    number_destroy(&tmp);
+
+    rc = stack_destroy(&numbers, number_destroy);
+    assert(STACK_RC_OK == rc && 4 == node_pool_count(pool));
+    rc = stack_destroy(&others, number_destroy);
+    assert(STACK_RC_OK == rc && 0 == node_pool_count(pool));
+    node_pool_destroy(&pool);
+
+    /* End of part 4. */
+
+    /* Part 5. Contiguous stack */
+
+    /* It should do nothing when trying to initialize a null stack */
+    stack_init_contiguous(NULL, 4);
+
+    numbers = stack_new_contiguous(4);
+    assert(NULL != numbers && numbers->contiguous && 0 == stack_count(numbers));
+
+    /* It should behave as an empty stack */
+    rc = stack_traverse(numbers, number_print);
+    assert(STACK_RC_EMPTY == rc);
+    assert(NULL == stack_pick(numbers) && NULL == stack_pop(numbers));
+    rc = stack_push(numbers, NULL);
+    assert(STACK_RC_ELEM_NULL == rc && 0 == stack_count(numbers));
+
+    /* It should only accept a null pool, as it has no nodes */
+    pool = node_pool_new(sizeof(s_l_list_node_s), 8);
+    rc = stack_set_pool(numbers, pool);
+    assert(STACK_RC_INVALID_POOL == rc);
+    rc = stack_set_pool(numbers, NULL);
+    assert(STACK_RC_OK == rc);
+    node_pool_destroy(&pool);
+
+    /* It should grow its array when pushing more elements than its initial capacity */
+    for (int i = 0; i < 100; i++) {
+        rc = stack_push(numbers, number_new(i));
+        assert(STACK_RC_OK == rc && (size_t)i + 1 == stack_count(numbers));
+        assert(i == *(int *)stack_pick(numbers));
+    }
+
+    assert(100 <= array_capacity(&numbers->array));
+
+    rc = stack_set_pool(numbers, NULL);
+    assert(STACK_RC_NOT_EMPTY == rc);
+    rc = stack_traverse(numbers, NULL);
+    assert(STACK_RC_ELEM_CB_NULL == rc);
+
+    /* It should pop the elements in the reverse order, without shrinking its array */
+    size_t capacity = array_capacity(&numbers->array);
+
+    for (int i = 99; i >= 50; i--) {
+        tmp = stack_pop(numbers);
+        assert(NULL != tmp && i == *(int *)tmp);
+        number_destroy(&tmp);
+    }
+
+    assert(50 == stack_count(numbers) && capacity == array_capacity(&numbers->array));
+
+    /* It should keep its capacity after being cleared */
+    rc = stack_clear(numbers, number_destroy);
+    assert(STACK_RC_OK == rc && 0 == stack_count(numbers));
+    assert(capacity == array_capacity(&numbers->array));
+
+    rc = stack_push(numbers, number_new(7));
+    assert(STACK_RC_OK == rc);
+    rc = stack_destroy(&numbers, number_destroy);
+    assert(STACK_RC_OK == rc && NULL == numbers);
+
+    /* End of part 5. */
+
     return 0;
 }
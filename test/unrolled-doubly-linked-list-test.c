@@ -0,0 +1,172 @@
+/**
+ * \file   unrolled-doubly-linked-list-test.c
+ * \brief  Circ. unrolled doubly linked list - unit test simulation for basic functions
+ */
+#include <assert.h>
+#include "libdatastructures/list/unrolled-doubly-linked-list.h"
+#include "number/number.h"
+
+/** The next number expected by 'number_check_next' */
+static int next_number;
+
+/** The step between the numbers expected by 'number_check_next' */
+static int number_step;
+
+/**
+ * \brief  Check a number element is the expected one, then expect the next one.
+ * \param  num  the number element
+ */
+static void number_check_next(void *num)
+{
+    assert(next_number == *(int *)num);
+    next_number += number_step;
+
+    return;
+}
+
+int main(void)
+{
+    u_d_l_list_rc_e rc;
+    void *tmp = NULL;
+
+    /* Part 1. Null list */
+    u_d_l_list_s *numbers = NULL;
+
+    /* It should do nothing when trying to initialize a null list */
+    u_d_l_list_init(numbers);
+    assert(NULL == numbers);
+
+    /* It should fail when trying to insert elements into a null list */
+    void *dummy = number_new(0);
+    rc = u_d_l_list_insert_front(numbers, dummy);
+    assert(U_D_L_LIST_RC_NULL == rc);
+    rc = u_d_l_list_insert_back(numbers, dummy);
+    assert(U_D_L_LIST_RC_NULL == rc);
+    assert(0 == u_d_l_list_count(numbers));
+
+    /* It should fail when trying to traverse a null list */
+    rc = u_d_l_list_traverse_forward(numbers, number_print);
+    assert(U_D_L_LIST_RC_NULL == rc);
+    rc = u_d_l_list_traverse_backward(numbers, number_print);
+    assert(U_D_L_LIST_RC_NULL == rc);
+
+    /* It should fail when trying to remove an element from a null list */
+    tmp = u_d_l_list_remove_front(numbers);
+    assert(NULL == tmp);
+    tmp = u_d_l_list_remove_back(numbers);
+    assert(NULL == tmp);
+
+    /* It should fail when trying to empty or destroy a null list */
+    rc = u_d_l_list_clear(numbers, number_destroy);
+    assert(U_D_L_LIST_RC_NULL == rc);
+    rc = u_d_l_list_destroy(NULL, number_destroy);
+    assert(U_D_L_LIST_RC_NULL == rc);
+    rc = u_d_l_list_destroy(&numbers, number_destroy);
+    assert(U_D_L_LIST_RC_NULL == rc);
+
+    /* End of part 1. */
+
+    /* Part 2. Empty list */
+    numbers = u_d_l_list_new();
+    assert(NULL != numbers && NULL == numbers->front && 0 == u_d_l_list_count(numbers));
+
+    /* It should fail when trying to insert a null element, traverse it or remove an element */
+    rc = u_d_l_list_insert_back(numbers, NULL);
+    assert(U_D_L_LIST_RC_ELEM_NULL == rc && 0 == u_d_l_list_count(numbers));
+    rc = u_d_l_list_traverse_forward(numbers, number_print);
+    assert(U_D_L_LIST_RC_EMPTY == rc);
+    rc = u_d_l_list_traverse_backward(numbers, number_print);
+    assert(U_D_L_LIST_RC_EMPTY == rc);
+    assert(NULL == u_d_l_list_remove_front(numbers));
+    assert(NULL == u_d_l_list_remove_back(numbers));
+
+    /* End of part 2. */
+
+    /* Part 3. List with a single element */
+
+    /* The list must have one node when inserting an element onto the empty list */
+    rc = u_d_l_list_insert_back(numbers, dummy);
+    assert(U_D_L_LIST_RC_OK == rc && NULL != numbers->front && 1 == numbers->front->count &&
+           numbers->front->next == numbers->front && numbers->front->prev == numbers->front &&
+           1 == u_d_l_list_count(numbers));
+
+    rc = u_d_l_list_traverse_forward(numbers, number_print);
+    assert(U_D_L_LIST_RC_OK == rc);
+
+    /* The list should be empty again after removing the single element from the list */
+    tmp = u_d_l_list_remove_front(numbers);
+    assert(dummy == tmp && NULL == numbers->front && 0 == u_d_l_list_count(numbers));
+
+    rc = u_d_l_list_insert_front(numbers, dummy);
+    assert(U_D_L_LIST_RC_OK == rc && NULL != numbers->front && 1 == u_d_l_list_count(numbers));
+    tmp = u_d_l_list_remove_back(numbers);
+    assert(dummy == tmp && NULL == numbers->front && 0 == u_d_l_list_count(numbers));
+
+    /* End of part 3. */
+
+    /* Part 4. List with multiple nodes */
+    const int half = 3 * U_D_L_LIST_NODE_LENGTH + 5;
+
+    /* It should fill every node before allocating another one, at both ends */
+    for (int i = 0; i < half; i++) {
+        rc = u_d_l_list_insert_back(numbers, number_new(half + i));
+        assert(U_D_L_LIST_RC_OK == rc);
+        rc = u_d_l_list_insert_front(numbers, number_new(half - 1 - i));
+        assert(U_D_L_LIST_RC_OK == rc);
+    }
+
+    assert(2 * (size_t)half == u_d_l_list_count(numbers));
+
+    size_t nodes = 0;
+    u_d_l_list_node_s *node = numbers->front;
+
+    do {
+        assert(0 < node->count && U_D_L_LIST_NODE_LENGTH >= node->count);
+        nodes++;
+        node = node->next;
+    } while (node != numbers->front);
+
+    /* The first node is shared by the elements inserted at both ends */
+    assert(7 == nodes);
+
+    /* It should traverse the elements in order, in both directions */
+    next_number = 0;
+    number_step = 1;
+    rc = u_d_l_list_traverse_forward(numbers, number_check_next);
+    assert(U_D_L_LIST_RC_OK == rc && 2 * half == next_number);
+
+    next_number = 2 * half - 1;
+    number_step = -1;
+    rc = u_d_l_list_traverse_backward(numbers, number_check_next);
+    assert(U_D_L_LIST_RC_OK == rc && -1 == next_number);
+
+    rc = u_d_l_list_traverse_forward(numbers, NULL);
+    assert(U_D_L_LIST_RC_ELEM_CB_NULL == rc);
+
+    /* It should remove the elements in order from both ends, deallocating the emptied nodes */
+    for (int i = 0; i < half - 1; i++) {
+        tmp = u_d_l_list_remove_front(numbers);
+        assert(NULL != tmp && i == *(int *)tmp);
+        number_destroy(&tmp);
+        tmp = u_d_l_list_remove_back(numbers);
+        assert(NULL != tmp && 2 * half - 1 - i == *(int *)tmp);
+        number_destroy(&tmp);
+    }
+
+    assert(2 == u_d_l_list_count(numbers) && numbers->front->next == numbers->front);
+
+    /* It should succeed at removing all elements from the list */
+    rc = u_d_l_list_clear(numbers, number_destroy);
+    assert(U_D_L_LIST_RC_OK == rc && NULL == numbers->front && 0 == u_d_l_list_count(numbers));
+
+    rc = u_d_l_list_insert_back(numbers, dummy);
+    assert(U_D_L_LIST_RC_OK == rc);
+    rc = u_d_l_list_destroy(&numbers, number_destroy);
+    assert(U_D_L_LIST_RC_OK == rc && NULL == numbers);
+
+    /* End of part 4. */
+
+    /* End of all tests. */
+
+    return 0;
+}
@@ -0,0 +1,233 @@
+/**
+ * \file   ws-deque-test.c
+ * \brief  Lock-free work-stealing deque - unit test simulation for basic functions
+ */
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include "libdatastructures/deque/ws-deque.h"
+#include "number/number.h"
+
+/** No. of thief threads */
+#define NTHIEVES 4
+
+/** No. of elements pushed by the owner thread */
+#define NELEMS 20000
+
+/** The deque shared by the owner thread and the thieves */
+static ws_deque_s *shared;
+
+/** The elements pushed by the owner */
+static int elems[NELEMS];
+
+/** No. of times every element has been taken (popped or stolen) */
+static atomic_int taken[NELEMS];
+
+/** Total no. of elements taken */
+static atomic_int total_taken;
+
+/**
+ * \brief  Record an element has been taken.
+ * \param  elem  the element
+ */
+static void elem_take(void *elem)
+{
+    atomic_fetch_add(&taken[*(int *)elem], 1);
+    atomic_fetch_add(&total_taken, 1);
+
+    return;
+}
+
+/**
+ * \brief   Steal elements until all the elements have been taken.
+ * \param   arg  unused
+ * \return  null
+ */
+static void *thief_run(void *arg)
+{
+    void *elem;
+
+    (void)arg;
+
+    while (NELEMS > atomic_load(&total_taken)) {
+        ws_deque_rc_e rc = ws_deque_steal_top(shared, &elem);
+
+        if (WS_DEQUE_RC_OK == rc)
+            elem_take(elem);
+        else if (WS_DEQUE_RC_EMPTY == rc)
+            sched_yield();
+        else
+            assert(WS_DEQUE_RC_ABORT == rc && NULL == elem);
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    ws_deque_rc_e rc;
+    void *tmp = NULL;
+
+    /* Part 1. Null deque */
+    ws_deque_s *numbers = NULL;
+
+    /* It should do nothing when trying to initialize a null deque */
+    ws_deque_init(numbers, 4);
+    assert(NULL == numbers);
+
+    /* It should fail when trying to push an element onto a null deque */
+    void *dummy = number_new(0);
+    rc = ws_deque_push_bottom(numbers, dummy);
+    assert(WS_DEQUE_RC_NULL == rc);
+
+    /* It should fail when trying to pop or steal an element off a null deque */
+    tmp = ws_deque_pop_bottom(numbers);
+    assert(NULL == tmp);
+    rc = ws_deque_steal_top(numbers, &tmp);
+    assert(WS_DEQUE_RC_NULL == rc);
+    assert(0 == ws_deque_count(numbers));
+
+    /* It should fail when trying to empty or destroy a null deque */
+    rc = ws_deque_clear(numbers, number_destroy);
+    assert(WS_DEQUE_RC_NULL == rc);
+    rc = ws_deque_destroy(NULL, number_destroy);
+    assert(WS_DEQUE_RC_NULL == rc);
+    rc = ws_deque_destroy(&numbers, number_destroy);
+    assert(WS_DEQUE_RC_NULL == rc);
+
+    /* End of part 1. */
+
+    /* Part 2. Empty deque */
+
+    /* It should allocate its array on the first push when the capacity is too large for it */
+    numbers = ws_deque_new(SIZE_MAX);
+    assert(NULL != numbers && NULL == atomic_load(&numbers->array));
+    rc = ws_deque_push_bottom(numbers, dummy);
+    assert(WS_DEQUE_RC_OK == rc && 1 == ws_deque_count(numbers));
+    tmp = ws_deque_pop_bottom(numbers);
+    assert(dummy == tmp && 0 == ws_deque_count(numbers));
+    rc = ws_deque_destroy(&numbers, number_destroy);
+    assert(WS_DEQUE_RC_EMPTY == rc && NULL == numbers);
+
+    numbers = ws_deque_new(0);
+    assert(NULL != numbers && 0 == ws_deque_count(numbers));
+
+    /* It should fail when trying to push a null element */
+    rc = ws_deque_push_bottom(numbers, NULL);
+    assert(WS_DEQUE_RC_ELEM_NULL == rc && 0 == ws_deque_count(numbers));
+
+    /* It should fail when trying to pop or steal an element off an empty deque */
+    tmp = ws_deque_pop_bottom(numbers);
+    assert(NULL == tmp && 0 == ws_deque_count(numbers));
+    rc = ws_deque_steal_top(numbers, NULL);
+    assert(WS_DEQUE_RC_ELEM_NULL == rc);
+    rc = ws_deque_steal_top(numbers, &tmp);
+    assert(WS_DEQUE_RC_EMPTY == rc && NULL == tmp);
+
+    /* It should return 'empty deque' when trying to empty an empty deque */
+    rc = ws_deque_clear(numbers, number_destroy);
+    assert(WS_DEQUE_RC_EMPTY == rc);
+
+    /* End of part 2. */
+
+    /* Part 3. Non-empty deque */
+
+    /* It should grow its array as needed when pushing elements */
+    for (int i = 0; i < 10; i++) {
+        rc = ws_deque_push_bottom(numbers, number_new(i));
+        assert(WS_DEQUE_RC_OK == rc && (size_t)i + 1 == ws_deque_count(numbers));
+    }
+
+    /* The owner should pop the most recently pushed elements, the thieves the least ones */
+    tmp = ws_deque_pop_bottom(numbers);
+    assert(NULL != tmp && 9 == *(int *)tmp && 9 == ws_deque_count(numbers));
+    number_destroy(&tmp);
+
+    rc = ws_deque_steal_top(numbers, &tmp);
+    assert(WS_DEQUE_RC_OK == rc && NULL != tmp && 0 == *(int *)tmp);
+    assert(8 == ws_deque_count(numbers));
+    number_destroy(&tmp);
+
+    rc = ws_deque_steal_top(numbers, &tmp);
+    assert(WS_DEQUE_RC_OK == rc && NULL != tmp && 1 == *(int *)tmp);
+    number_destroy(&tmp);
+
+    /* It should keep the elements in order while growing its array again, after wrapping */
+    for (int i = 10; i < 40; i++) {
+        rc = ws_deque_push_bottom(numbers, number_new(i));
+        assert(WS_DEQUE_RC_OK == rc);
+    }
+
+    assert(37 == ws_deque_count(numbers));
+
+    for (int i = 2; i < 9; i++) {
+        rc = ws_deque_steal_top(numbers, &tmp);
+        assert(WS_DEQUE_RC_OK == rc && NULL != tmp && i == *(int *)tmp);
+        number_destroy(&tmp);
+    }
+
+    for (int i = 39; i >= 30; i--) {
+        tmp = ws_deque_pop_bottom(numbers);
+        assert(NULL != tmp && i == *(int *)tmp);
+        number_destroy(&tmp);
+    }
+
+    /* It should succeed at removing all elements from the deque, handing them to the callback */
+    rc = ws_deque_clear(numbers, number_destroy);
+    assert(WS_DEQUE_RC_OK == rc && 0 == ws_deque_count(numbers));
+
+    rc = ws_deque_push_bottom(numbers, dummy);
+    assert(WS_DEQUE_RC_OK == rc);
+    rc = ws_deque_destroy(&numbers, number_destroy);
+    assert(WS_DEQUE_RC_OK == rc && NULL == numbers);
+
+    /* End of part 3. */
+
+    /* Part 4. Deque shared by its owner and many thieves */
+    pthread_t thieves[NTHIEVES];
+
+    shared = ws_deque_new(4);
+    assert(NULL != shared);
+
+    for (int i = 0; i < NELEMS; i++) {
+        elems[i] = i;
+        atomic_init(&taken[i], 0);
+    }
+
+    atomic_init(&total_taken, 0);
+
+    for (int i = 0; i < NTHIEVES; i++) {
+        int err = pthread_create(&thieves[i], NULL, thief_run, NULL);
+        assert(0 == err);
+    }
+
+    /* The owner pushes all the elements, popping one after every third one pushed */
+    for (int i = 0; i < NELEMS; i++) {
+        rc = ws_deque_push_bottom(shared, &elems[i]);
+        assert(WS_DEQUE_RC_OK == rc);
+
+        if (2 == i % 3 && NULL != (tmp = ws_deque_pop_bottom(shared)))
+            elem_take(tmp);
+    }
+
+    while (NULL != (tmp = ws_deque_pop_bottom(shared)))
+        elem_take(tmp);
+
+    for (int i = 0; i < NTHIEVES; i++)
+        pthread_join(thieves[i], NULL);
+
+    /* Every element should be taken exactly once, either by the owner or by a thief */
+    for (int i = 0; i < NELEMS; i++)
+        assert(1 == atomic_load(&taken[i]));
+
+    rc = ws_deque_destroy(&shared, NULL);
+    assert(WS_DEQUE_RC_EMPTY == rc && NULL == shared);
+
+    /* End of part 4. */
+
+    /* End of all tests. */
+
+    return 0;
+}